@@ -0,0 +1,91 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_METRICS_H_
+#define V8_METRICS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "v8config.h"  // NOLINT(build/include)
+
+namespace v8 {
+namespace metrics {
+
+/**
+ * Time spent in a single phase of a garbage collection cycle. Phase names are
+ * the same as the ones printed by --trace-gc-nvp and used for trace events,
+ * e.g. "V8.GC_MC_MARK" or "V8.GC_SCAVENGER_SCAVENGE_ROOTS". Phases may nest,
+ * e.g. "V8.GC_MC_MARK_ROOTS" is part of "V8.GC_MC_MARK". Phases that ran on
+ * background threads have the summed up time of all threads.
+ */
+struct GarbageCollectionPhase {
+  const char* name;
+  double duration_in_ms;
+};
+
+/**
+ * Describes a single, completed garbage collection cycle.
+ */
+struct GarbageCollectionCycle {
+  enum class Type {
+    kScavenge,
+    kMinorMarkCompact,
+    kMarkCompact,
+    kIncrementalMarkCompact
+  };
+
+  Type type;
+  // Human readable reason for the garbage collection, e.g. "allocation
+  // failure" or "testing".
+  const char* reason;
+  // Whether the garbage collection tried to reduce memory usage.
+  bool reduce_memory;
+
+  // Start and end of the atomic pause on the main thread, measured by the
+  // platform's monotonic clock.
+  double start_time_in_ms;
+  double end_time_in_ms;
+  // Time spent in incremental marking steps on the main thread before the
+  // atomic pause. Only set for kIncrementalMarkCompact.
+  double incremental_marking_duration_in_ms;
+  int incremental_marking_steps;
+  // Time spent in background threads on behalf of this cycle.
+  double background_duration_in_ms;
+
+  // Size of live objects and of memory allocated from the OS before and after
+  // the cycle.
+  size_t start_object_size_in_bytes;
+  size_t end_object_size_in_bytes;
+  size_t start_memory_size_in_bytes;
+  size_t end_memory_size_in_bytes;
+  // Bytes of young objects that survived the cycle, and the part of them that
+  // was promoted to the old generation.
+  size_t survived_young_object_size_in_bytes;
+  size_t promoted_object_size_in_bytes;
+
+  // Breakdown of the cycle into phases. Only phases that took time are listed.
+  // The array is only valid for the duration of the callback.
+  const GarbageCollectionPhase* phases;
+  size_t phase_count;
+};
+
+/**
+ * Receives structured metrics events from an isolate. Install it with
+ * Isolate::SetMetricsRecorder. Events are delivered on the thread that runs
+ * the isolate, right after the corresponding garbage collection finished but
+ * before the heap is accessible again, so implementations must not call back
+ * into V8. Isolates without a recorder do not collect any of this data.
+ */
+class V8_EXPORT Recorder {
+ public:
+  virtual ~Recorder() = default;
+
+  virtual void AddMainThreadEvent(const GarbageCollectionCycle& event) {}
+};
+
+}  // namespace metrics
+}  // namespace v8
+
+#endif  // V8_METRICS_H_
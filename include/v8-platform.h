@@ -113,6 +113,108 @@ class TaskRunner {
   TaskRunner& operator=(const TaskRunner&) = delete;
 };
 
+/**
+ * Delegate that's passed to Job's worker task, providing an entry point to
+ * communicate with the scheduler.
+ */
+class JobDelegate {
+ public:
+  /**
+   * Returns true if this thread should return from the worker task on the
+   * current thread ASAP. Workers should periodically invoke ShouldYield (or
+   * YieldIfNeeded()) as often as is reasonable.
+   */
+  virtual bool ShouldYield() = 0;
+
+  /**
+   * Notifies the scheduler that max concurrency was increased, and the number
+   * of worker should be adjusted accordingly. See Platform::PostJob() for more
+   * details.
+   */
+  virtual void NotifyConcurrencyIncrease() = 0;
+};
+
+/**
+ * Handle returned when posting a Job. Provides methods to control execution of
+ * the posted Job.
+ */
+class JobHandle {
+ public:
+  virtual ~JobHandle() = default;
+
+  /**
+   * Notifies the scheduler that max concurrency was increased, and the number
+   * of worker should be adjusted accordingly. See Platform::PostJob() for more
+   * details.
+   */
+  virtual void NotifyConcurrencyIncrease() = 0;
+
+  /**
+   * Contributes to the job on this thread. Doesn't return until all tasks have
+   * completed and max concurrency becomes 0. When Join() is called and max
+   * concurrency reaches 0, it should not increase again. This also promotes
+   * this Job's priority to be at least as high as the calling thread's
+   * priority.
+   */
+  virtual void Join() = 0;
+
+  /**
+   * Forces all existing workers to yield ASAP. Waits until they have all
+   * returned from the Job's callback before returning.
+   */
+  virtual void Cancel() = 0;
+
+  /**
+   * Returns true if associated with a Job and other methods may be called.
+   * Returns false after Join() or Cancel() was called.
+   */
+  virtual bool IsRunning() = 0;
+};
+
+/**
+ * A JobTask represents work to run in parallel from Platform::PostJob().
+ */
+class JobTask {
+ public:
+  virtual ~JobTask() = default;
+
+  virtual void Run(JobDelegate* delegate) = 0;
+
+  /**
+   * Controls the maximum number of threads calling Run() concurrently. Run() is
+   * only invoked if the number of threads previously running Run() was less
+   * than the value returned. Since GetMaxConcurrency() is a leaf function, it
+   * must not call back any JobHandle methods.
+   */
+  virtual size_t GetMaxConcurrency() const = 0;
+};
+
+/**
+ * Priority of a Job or a worker task, ordered from lowest to highest. Jobs
+ * posted with a higher priority are expected to be scheduled ahead of those
+ * with a lower priority.
+ */
+enum class TaskPriority : uint8_t {
+  /**
+   * Best effort tasks are not critical for performance of the application. The
+   * platform implementation should preempt such tasks if higher priority tasks
+   * arrive.
+   */
+  kBestEffort,
+  /**
+   * User visible tasks are long running background tasks that will
+   * improve performance and memory usage of the application upon completion.
+   * Example: background compilation and garbage collection.
+   */
+  kUserVisible,
+  /**
+   * User blocking tasks are highest priority tasks that block the execution
+   * thread (e.g. major garbage collection). They must be finished as soon as
+   * possible.
+   */
+  kUserBlocking,
+};
+
 /**
  * The interface represents complex arguments to trace events.
  */
@@ -362,6 +464,56 @@ class Platform {
   virtual void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                          double delay_in_seconds) = 0;
 
+  /**
+   * Posts |job_task| to run in parallel. Returns a JobHandle associated with
+   * the Job, which can be joined or canceled.
+   * This offers a more fine-grained control compared to CallOnWorkerThread():
+   * instead of posting one task per unit of work, a single JobTask is posted
+   * and the platform decides how many workers run it concurrently, based on
+   * JobTask::GetMaxConcurrency(). Work items are pulled from within Run(), so
+   * a parallel phase does not go through the worker queue once per item.
+   * JobDelegate::ShouldYield() must be polled by the worker to let the
+   * platform reclaim the thread, e.g. for higher priority work.
+   * Whenever GetMaxConcurrency() increases, NotifyConcurrencyIncrease() must
+   * be called so that the platform can spawn additional workers.
+   * Returns nullptr if the platform does not support jobs, in which case the
+   * caller has to fall back to CallOnWorkerThread(). Embedders can use
+   * v8::platform::NewDefaultJobHandle() to implement this on top of their
+   * worker threads.
+   *
+   * Example:
+   * ```
+   * class MyJobTask : public JobTask {
+   *  public:
+   *   MyJobTask(std::atomic<size_t>* num_work_items)
+   *      : num_work_items_(num_work_items) {}
+   *
+   *   void Run(JobDelegate* delegate) override {
+   *     while (!delegate->ShouldYield()) {
+   *       // Smallest unit of work.
+   *       WorkItem work_item = TakeWorkItem();  // Thread safe.
+   *       if (!work_item) return;
+   *       ProcessWork(work_item);
+   *       num_work_items_->fetch_sub(1, std::memory_order_relaxed);
+   *     }
+   *   }
+   *
+   *   size_t GetMaxConcurrency() const override {
+   *     return num_work_items_->load(std::memory_order_relaxed);
+   *   }
+   *
+   *  private:
+   *   std::atomic<size_t>* num_work_items_;
+   * };
+   * ```
+   */
+  virtual std::unique_ptr<JobHandle> PostJob(
+      TaskPriority priority, std::unique_ptr<JobTask> job_task) {
+    // Embedders may optionally override this to support jobs, e.g. by
+    // returning v8::platform::NewDefaultJobHandle().
+    return nullptr;
+  }
+
   /**
    * Schedules a task to be invoked on a foreground thread wrt a specific
    * |isolate|. Tasks posted for the same isolate should be execute in order of
@@ -140,6 +140,10 @@ namespace debug {
 class ConsoleCallArguments;
 }  // namespace debug
 
+namespace metrics {
+class Recorder;
+}  // namespace metrics
+
 // --- Handles ---
 
 #define TYPE_CHECK(T, S)                                       \
@@ -1471,6 +1475,22 @@ class V8_EXPORT ScriptCompiler {
      */
     virtual size_t GetMoreData(const uint8_t** src) = 0;
 
+    /**
+     * V8 calls this once, before the first GetMoreData call, to ask whether
+     * the embedder keeps ownership of the data returned by GetMoreData. If
+     * this returns true, V8 reads the data in place instead of taking
+     * ownership of it. The data must then stay valid and unchanged until the
+     * stream is destroyed. V8 may keep the stream alive after the
+     * StreamedSource is gone, e.g. for compile tasks on background threads,
+     * and may destroy it on such a thread.
+     *
+     * This avoids copying sources that the embedder already holds in memory.
+     * To also avoid copying the source onto the V8 heap, pass an external
+     * string backed by the same memory as the full source string to
+     * ScriptCompiler::Compile.
+     */
+    virtual bool KeepsDataOwnership();
+
     /**
      * V8 calls this method to set a 'bookmark' at the current position in
      * the source stream, for the purpose of (maybe) later calling
@@ -8075,6 +8095,14 @@ class V8_EXPORT Isolate {
                                 void* data = nullptr);
   void RemoveGCEpilogueCallback(GCCallback callback);
 
+  /**
+   * Installs a recorder that receives a structured event for every garbage
+   * collection cycle of this isolate, see v8-metrics.h. Passing nullptr
+   * removes the recorder.
+   */
+  void SetMetricsRecorder(
+      const std::shared_ptr<metrics::Recorder>& metrics_recorder);
+
   typedef size_t (*GetExternallyAllocatedMemoryInBytesCallback)();
 
   /**
@@ -8433,6 +8461,17 @@ class V8_EXPORT Isolate {
    */
   void AutomaticallyRestoreInitialHeapLimit(double threshold_percent = 0.5);
 
+  /**
+   * Changes the maximum size of the old generation at runtime, e.g. when the
+   * memory limit of the surrounding container changes. The new limit is
+   * clamped so that it does not fall below the current live size plus some
+   * slack. Lowering the limit schedules garbage collection ahead of the new
+   * limit. The new limit also becomes the initial heap limit that is passed
+   * to NearHeapLimitCallback and restored by
+   * AutomaticallyRestoreInitialHeapLimit.
+   */
+  void SetMaxOldGenerationSize(size_t max_old_generation_size_in_bytes);
+
   /**
    * Set the callback to invoke to check if code generation from
    * strings should be allowed.
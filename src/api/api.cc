@@ -2042,6 +2042,10 @@ ScriptCompiler::CachedData::~CachedData() {
   }
 }
 
+bool ScriptCompiler::ExternalSourceStream::KeepsDataOwnership() {
+  return false;
+}
+
 bool ScriptCompiler::ExternalSourceStream::SetBookmark() { return false; }
 
 void ScriptCompiler::ExternalSourceStream::ResetToBookmark() { UNREACHABLE(); }
@@ -7760,6 +7764,12 @@ EmbedderHeapTracer* Isolate::GetEmbedderHeapTracer() {
   return isolate->heap()->GetEmbedderHeapTracer();
 }
 
+void Isolate::SetMetricsRecorder(
+    const std::shared_ptr<metrics::Recorder>& metrics_recorder) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_metrics_recorder(metrics_recorder);
+}
+
 void Isolate::SetGetExternallyAllocatedMemoryInBytesCallback(
     GetExternallyAllocatedMemoryInBytesCallback callback) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -8458,6 +8468,11 @@ void Isolate::AutomaticallyRestoreInitialHeapLimit(double threshold_percent) {
   isolate->heap()->AutomaticallyRestoreInitialHeapLimit(threshold_percent);
 }
 
+void Isolate::SetMaxOldGenerationSize(size_t max_old_generation_size_in_bytes) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetMaxOldGenerationSize(max_old_generation_size_in_bytes);
+}
+
 bool Isolate::IsDead() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->IsDead();
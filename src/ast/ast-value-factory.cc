@@ -60,14 +60,33 @@ void AstRawString::Internalize(Isolate* isolate) {
     set_string(isolate->factory()->empty_string());
   } else if (is_one_byte()) {
     OneByteStringKey key(hash_field_, literal_bytes_);
-    set_string(StringTable::LookupKey(isolate, &key));
+    set_string(StringTable::LookupKeyNoShrink(isolate, &key));
   } else {
     TwoByteStringKey key(hash_field_,
                          Vector<const uint16_t>::cast(literal_bytes_));
-    set_string(StringTable::LookupKey(isolate, &key));
+    set_string(StringTable::LookupKeyNoShrink(isolate, &key));
   }
 }
 
+bool AstRawString::InternalizeIfExists(Isolate* isolate) {
+  DCHECK(!has_string_);
+  MaybeHandle<String> existing;
+  if (literal_bytes_.length() == 0) {
+    existing = isolate->factory()->empty_string();
+  } else if (is_one_byte()) {
+    OneByteStringKey key(hash_field_, literal_bytes_);
+    existing = StringTable::LookupKeyIfExists(isolate, &key);
+  } else {
+    TwoByteStringKey key(hash_field_,
+                         Vector<const uint16_t>::cast(literal_bytes_));
+    existing = StringTable::LookupKeyIfExists(isolate, &key);
+  }
+  Handle<String> string;
+  if (!existing.ToHandle(&string)) return false;
+  set_string(string);
+  return true;
+}
+
 bool AstRawString::AsArrayIndex(uint32_t* index) const {
   // The StringHasher will set up the hash in such a way that we can use it to
   // figure out whether the string is convertible to an array index.
@@ -249,7 +268,27 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 void AstValueFactory::Internalize(Isolate* isolate) {
   // Strings need to be internalized before values, because values refer to
   // strings.
+  // Many strings of a parse, e.g. keywords and common property names, are
+  // already in the string table. Resolve those first, then grow the table
+  // once for the remaining ones instead of rehashing it repeatedly while they
+  // are added one by one. Internalizing a string overwrites its next pointer,
+  // so the new ones are relinked into a separate list.
+  AstRawString* new_strings = nullptr;
+  AstRawString** new_strings_end = &new_strings;
+  int new_string_count = 0;
   for (AstRawString* current = strings_; current != nullptr;) {
+    AstRawString* next = current->next();
+    if (!current->InternalizeIfExists(isolate)) {
+      *new_strings_end = current;
+      new_strings_end = current->next_location();
+      new_string_count++;
+    }
+    current = next;
+  }
+  *new_strings_end = nullptr;
+
+  StringTable::EnsureCapacityForBulkInsertion(isolate, new_string_count);
+  for (AstRawString* current = new_strings; current != nullptr;) {
     AstRawString* next = current->next();
     current->Internalize(isolate);
     current = next;
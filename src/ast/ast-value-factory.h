@@ -56,6 +56,9 @@ class AstRawString final : public ZoneObject {
   uint16_t FirstCharacter() const;
 
   void Internalize(Isolate* isolate);
+  // Internalizes the string only if the string table already contains it.
+  // Returns whether it did so.
+  bool InternalizeIfExists(Isolate* isolate);
 
   // Access the physical representation:
   bool is_one_byte() const { return is_one_byte_; }
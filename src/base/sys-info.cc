@@ -18,6 +18,8 @@
 #include <sys/sysctl.h>
 #endif
 
+#include <stdio.h>
+
 #include <limits>
 
 #include "src/base/logging.h"
@@ -29,6 +31,34 @@
 namespace v8 {
 namespace base {
 
+#if V8_OS_LINUX
+namespace {
+
+// Reads a single byte count from a cgroup control file. Returns 0 if the file
+// does not exist or does not hold a number, e.g. if it holds "max".
+int64_t ReadCgroupMemoryValue(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return 0;
+  long long value = 0;  // NOLINT(runtime/int)
+  int matched = fscanf(file, "%lld", &value);
+  fclose(file);
+  if (matched != 1 || value <= 0) return 0;
+  return static_cast<int64_t>(value);
+}
+
+// Returns the memory limit of the cgroup this process runs in, or 0 if there
+// is no limit. Both the unified (v2) and the legacy (v1) hierarchy are
+// supported. Unlimited v1 cgroups report a huge page-aligned value, which the
+// caller filters out by comparing against the physical memory size.
+int64_t CgroupMemoryLimit() {
+  int64_t limit = ReadCgroupMemoryValue("/sys/fs/cgroup/memory.max");
+  if (limit > 0) return limit;
+  return ReadCgroupMemoryValue("/sys/fs/cgroup/memory/memory.limit_in_bytes");
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
 // static
 int SysInfo::NumberOfProcessors() {
 #if V8_OS_OPENBSD
@@ -96,7 +126,12 @@ int64_t SysInfo::AmountOfPhysicalMemory() {
   if (pages == -1 || page_size == -1) {
     return 0;
   }
-  return static_cast<int64_t>(pages) * page_size;
+  int64_t result = static_cast<int64_t>(pages) * page_size;
+#if V8_OS_LINUX
+  int64_t cgroup_limit = CgroupMemoryLimit();
+  if (cgroup_limit > 0 && cgroup_limit < result) result = cgroup_limit;
+#endif
+  return result;
 #endif
 }
 
@@ -38,6 +38,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/rewriter.h"
 #include "src/parsing/scanner-character-streams.h"
+#include "src/snapshot/cached-feedback.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/ostreams.h"
 #include "src/zone/zone-list-inl.h"  // crbug.com/v8/8816
@@ -737,7 +738,8 @@ bool GetOptimizedCodeNow(OptimizedCompilationJob* job, Isolate* isolate) {
   return true;
 }
 
-bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
+bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate,
+                           int priority) {
   OptimizedCompilationInfo* compilation_info = job->compilation_info();
   if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
     if (FLAG_trace_concurrent_recompilation) {
@@ -764,7 +766,8 @@ bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
                "V8.RecompileSynchronous");
 
   if (job->PrepareJob(isolate) != CompilationJob::SUCCEEDED) return false;
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job);
+  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job,
+                                                                  priority);
 
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Queued ");
@@ -829,6 +832,11 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   DCHECK(shared->is_compiled());
   function->feedback_vector().set_profiler_ticks(0);
 
+  // Concurrent jobs of functions that were called more often are compiled
+  // first. Unlike the profiler ticks, which are all close to the marking
+  // threshold by now, the invocation count tells hot functions apart.
+  int priority = function->feedback_vector().invocation_count();
+
   VMState<COMPILER> state(isolate);
   TimerEventScope<TimerEventOptimizeCode> optimize_code_timer(isolate);
   RuntimeCallTimerScope runtimeTimer(isolate,
@@ -860,6 +868,12 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     return MaybeHandle<Code>();
   }
 
+  // Remember the function, so that its feedback can be stored in code caches
+  // produced for its script.
+  if (FLAG_cache_feedback) {
+    isolate->EnsureCachedFeedback()->RecordOptimizedFunction(isolate, function);
+  }
+
   // In case of concurrent recompilation, all handles below this point will be
   // allocated in a deferred handle scope that is detached and handed off to
   // the background thread when we return.
@@ -875,7 +889,7 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   compilation_info->ReopenHandlesInNewHandleScope(isolate);
 
   if (mode == ConcurrencyMode::kConcurrent) {
-    if (GetOptimizedCodeLater(job.get(), isolate)) {
+    if (GetOptimizedCodeLater(job.get(), isolate, priority)) {
       job.release();  // The background recompile job owns this now.
 
       // Set the optimization marker and return a code object which checks it.
@@ -928,9 +942,17 @@ void FinalizeScriptCompilation(Isolate* isolate, ParseInfo* parse_info) {
         dispatcher->AbortJob(job_id);
       }
     }
+    parse_info->parallel_tasks()->Clear();
   }
 }
 
+// Aborts parallel tasks that won't be registered with a shared function info
+// because the script was not finalized.
+void AbortParallelTasks(ParseInfo* parse_info) {
+  if (!parse_info->parallel_tasks()) return;
+  parse_info->parallel_tasks()->AbortAll();
+}
+
 MaybeHandle<SharedFunctionInfo> FinalizeTopLevel(
     ParseInfo* parse_info, Isolate* isolate,
     UnoptimizedCompilationJob* outer_function_job,
@@ -1047,7 +1069,7 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
       stricter_language_mode(info_->language_mode(), language_mode));
 
   std::unique_ptr<Utf16CharacterStream> stream(ScannerStream::For(
-      streamed_data->source_stream.get(), streamed_data->encoding));
+      streamed_data->source_stream, streamed_data->encoding));
   info_->set_character_stream(std::move(stream));
 }
 
@@ -2160,6 +2182,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
           isolate->native_context(), parse_info->language_mode());
   if (!maybe_result.is_null()) {
     compile_timer.set_hit_isolate_cache();
+    AbortParallelTasks(parse_info);
   }
 
   if (maybe_result.is_null()) {
@@ -2175,8 +2198,11 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
       // Parsing has failed - report error messages.
       FailWithPendingException(isolate, parse_info,
                                Compiler::ClearExceptionFlag::KEEP_EXCEPTION);
+      AbortParallelTasks(parse_info);
     } else {
-      // Parsing has succeeded - finalize compilation.
+      // Parsing has succeeded - finalize compilation. This also registers
+      // the inner functions compiled by parallel tasks with their shared
+      // function infos.
       maybe_result =
           FinalizeTopLevel(parse_info, isolate, task->outer_function_job(),
                            task->inner_function_jobs());
@@ -2184,6 +2210,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
         // Finalization failed - throw an exception.
         FailWithPendingException(isolate, parse_info,
                                  Compiler::ClearExceptionFlag::KEEP_EXCEPTION);
+        AbortParallelTasks(parse_info);
       }
     }
 
@@ -397,8 +397,9 @@ struct ScriptStreamingData {
 
   void Release();
 
-  // Internal implementation of v8::ScriptCompiler::StreamedSource.
-  std::unique_ptr<ScriptCompiler::ExternalSourceStream> source_stream;
+  // Internal implementation of v8::ScriptCompiler::StreamedSource. Shared
+  // with character streams that read data owned by the source stream.
+  std::shared_ptr<ScriptCompiler::ExternalSourceStream> source_stream;
   ScriptCompiler::StreamedSource::Encoding encoding;
 
   // Task that performs background parsing and compilation.
@@ -20,10 +20,38 @@
 namespace v8 {
 namespace internal {
 
+void CompilerDispatcherJobGroup::Abandon() {
+  base::MutexGuard lock(&mutex_);
+  abandoned_ = true;
+  if (job_count_ > 0) dispatcher_->ScheduleAbortOfAbandonedJobs();
+}
+
+bool CompilerDispatcherJobGroup::IsAbandoned() {
+  base::MutexGuard lock(&mutex_);
+  return abandoned_;
+}
+
+void CompilerDispatcherJobGroup::AddJob() {
+  base::MutexGuard lock(&mutex_);
+  ++job_count_;
+}
+
+void CompilerDispatcherJobGroup::ReleaseJob() {
+  base::MutexGuard lock(&mutex_);
+  DCHECK_LT(0, job_count_);
+  --job_count_;
+}
+
 CompilerDispatcher::Job::Job(BackgroundCompileTask* task_arg)
     : task(task_arg), has_run(false), aborted(false) {}
 
-CompilerDispatcher::Job::~Job() = default;
+CompilerDispatcher::Job::~Job() { DCHECK(!group); }
+
+void CompilerDispatcher::Job::ReleaseGroup() {
+  if (!group) return;
+  group->ReleaseJob();
+  group.reset();
+}
 
 CompilerDispatcher::CompilerDispatcher(Isolate* isolate, Platform* platform,
                                        size_t max_stack_size)
@@ -39,8 +67,8 @@ CompilerDispatcher::CompilerDispatcher(Isolate* isolate, Platform* platform,
       max_stack_size_(max_stack_size),
       trace_compiler_dispatcher_(FLAG_trace_compiler_dispatcher),
       task_manager_(new CancelableTaskManager()),
-      next_job_id_(0),
       shared_to_unoptimized_job_id_(isolate->heap()),
+      next_job_id_(0),
       idle_task_scheduled_(false),
       num_worker_tasks_(0),
       main_thread_blocking_on_job_(nullptr),
@@ -58,11 +86,15 @@ CompilerDispatcher::~CompilerDispatcher() {
 
 base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
     const ParseInfo* outer_parse_info, const AstRawString* function_name,
-    const FunctionLiteral* function_literal) {
+    const FunctionLiteral* function_literal,
+    std::shared_ptr<CompilerDispatcherJobGroup> group) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompilerDispatcherEnqueue");
+  // The outer parse info may be parsed on a background thread (e.g. when
+  // streaming a script), so don't use the isolate's runtime call stats.
   RuntimeCallTimerScope runtimeTimer(
-      isolate_, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
+      outer_parse_info->runtime_call_stats(),
+      RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
 
   if (!IsEnabled()) return base::nullopt;
 
@@ -70,8 +102,21 @@ base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
       allocator_, outer_parse_info, function_name, function_literal,
       worker_thread_runtime_call_stats_, background_compile_timer_,
       static_cast<int>(max_stack_size_)));
-  JobMap::const_iterator it = InsertJob(std::move(job));
-  JobId id = it->first;
+  if (group) {
+    group->AddJob();
+    job->group = std::move(group);
+  }
+  Job* job_ptr = job.get();
+  JobId id;
+  if (outer_parse_info->on_background_thread()) {
+    // Only the main thread may access |jobs_|, so park the job until the main
+    // thread adopts it when finalizing the outer script.
+    base::MutexGuard lock(&mutex_);
+    id = next_job_id_++;
+    off_thread_jobs_.insert(std::make_pair(id, std::move(job)));
+  } else {
+    id = InsertJob(std::move(job))->first;
+  }
   if (trace_compiler_dispatcher_) {
     PrintF("CompilerDispatcher: enqueued job %zu for function literal id %d\n",
            id, function_literal->function_literal_id());
@@ -81,7 +126,7 @@ base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
   // thread.
   {
     base::MutexGuard lock(&mutex_);
-    pending_background_jobs_.insert(it->second.get());
+    pending_background_jobs_.insert(job_ptr);
   }
   ScheduleMoreWorkerTasksIfNeeded();
   return base::make_optional(id);
@@ -100,6 +145,7 @@ bool CompilerDispatcher::IsEnqueued(JobId job_id) const {
 
 void CompilerDispatcher::RegisterSharedFunctionInfo(
     JobId job_id, SharedFunctionInfo function) {
+  AdoptOffThreadJobs();
   DCHECK_NE(jobs_.find(job_id), jobs_.end());
 
   if (trace_compiler_dispatcher_) {
@@ -117,6 +163,8 @@ void CompilerDispatcher::RegisterSharedFunctionInfo(
   DCHECK_NE(job_it, jobs_.end());
   Job* job = job_it->second.get();
   shared_to_unoptimized_job_id_.Set(function_handle, job_id);
+  // Registered jobs are finalized or aborted by the dispatcher itself.
+  job->ReleaseGroup();
 
   {
     base::MutexGuard lock(&mutex_);
@@ -183,8 +231,10 @@ void CompilerDispatcher::AbortJob(JobId job_id) {
   if (trace_compiler_dispatcher_) {
     PrintF("CompilerDispatcher: aborted job %zu\n", job_id);
   }
+  AdoptOffThreadJobs();
   JobMap::const_iterator job_it = jobs_.find(job_id);
   Job* job = job_it->second.get();
+  job->ReleaseGroup();
 
   base::LockGuard<base::Mutex> lock(&mutex_);
   pending_background_jobs_.erase(job);
@@ -199,9 +249,11 @@ void CompilerDispatcher::AbortJob(JobId job_id) {
 
 void CompilerDispatcher::AbortAll() {
   task_manager_->TryAbortAll();
+  AdoptOffThreadJobs();
 
   for (auto& it : jobs_) {
     WaitForJobIfRunningOnBackground(it.second.get());
+    it.second->ReleaseGroup();
     if (trace_compiler_dispatcher_) {
       PrintF("CompilerDispatcher: aborted job %zu\n", it.first);
     }
@@ -314,6 +366,8 @@ void CompilerDispatcher::DoIdleWork(double deadline_in_seconds) {
     idle_task_scheduled_ = false;
   }
 
+  AbortAbandonedJobs();
+
   if (trace_compiler_dispatcher_) {
     PrintF("CompilerDispatcher: received %0.1lfms of idle time\n",
            (deadline_in_seconds - platform_->MonotonicallyIncreasingTime()) *
@@ -356,17 +410,61 @@ void CompilerDispatcher::DoIdleWork(double deadline_in_seconds) {
 
 CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::InsertJob(
     std::unique_ptr<Job> job) {
+  JobId id;
+  {
+    base::MutexGuard lock(&mutex_);
+    id = next_job_id_++;
+  }
   bool added;
   JobMap::const_iterator it;
-  std::tie(it, added) =
-      jobs_.insert(std::make_pair(next_job_id_++, std::move(job)));
+  std::tie(it, added) = jobs_.insert(std::make_pair(id, std::move(job)));
   DCHECK(added);
   return it;
 }
 
+void CompilerDispatcher::AdoptOffThreadJobs() {
+  base::MutexGuard lock(&mutex_);
+  if (off_thread_jobs_.empty()) return;
+  for (auto& it : off_thread_jobs_) {
+    jobs_.insert(std::make_pair(it.first, std::move(it.second)));
+  }
+  off_thread_jobs_.clear();
+}
+
+void CompilerDispatcher::ScheduleAbortOfAbandonedJobs() {
+  base::MutexGuard lock(&mutex_);
+  ScheduleIdleTaskFromAnyThread(lock);
+}
+
+void CompilerDispatcher::AbortAbandonedJobs() {
+  AdoptOffThreadJobs();
+  for (JobMap::const_iterator it = jobs_.cbegin(); it != jobs_.cend();) {
+    Job* job = it->second.get();
+    if (!job->group || !job->group->IsAbandoned()) {
+      ++it;
+      continue;
+    }
+    if (trace_compiler_dispatcher_) {
+      PrintF("CompilerDispatcher: aborted abandoned job %zu\n", it->first);
+    }
+    job->ReleaseGroup();
+
+    base::MutexGuard lock(&mutex_);
+    pending_background_jobs_.erase(job);
+    if (running_background_jobs_.find(job) == running_background_jobs_.end()) {
+      it = RemoveJob(it);
+    } else {
+      // Remove the job once it is done on the background thread.
+      job->aborted = true;
+      ++it;
+    }
+  }
+}
+
 CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::RemoveJob(
     CompilerDispatcher::JobMap::const_iterator it) {
   Job* job = it->second.get();
+  job->ReleaseGroup();
 
   DCHECK_EQ(running_background_jobs_.find(job), running_background_jobs_.end());
   DCHECK_EQ(pending_background_jobs_.find(job), pending_background_jobs_.end());
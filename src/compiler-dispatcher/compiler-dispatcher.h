@@ -47,6 +47,38 @@ class Zone;
 template <typename T>
 class Handle;
 
+class CompilerDispatcher;
+
+// Tracks the jobs that were enqueued for one outer script and are not yet
+// registered with a shared function info. The owner of the group, e.g. the
+// ParseInfo of a streamed script, abandons it when the script is dropped
+// before it is finalized, and the dispatcher then aborts the jobs on the main
+// thread. Abandon() may be called from any thread, also after the dispatcher
+// was torn down, since the dispatcher releases all jobs before that.
+class V8_EXPORT_PRIVATE CompilerDispatcherJobGroup {
+ public:
+  explicit CompilerDispatcherJobGroup(CompilerDispatcher* dispatcher)
+      : dispatcher_(dispatcher) {}
+
+  void Abandon();
+  bool IsAbandoned();
+
+ private:
+  friend class CompilerDispatcher;
+
+  void AddJob();
+  void ReleaseJob();
+
+  base::Mutex mutex_;
+  CompilerDispatcher* const dispatcher_;
+  // Number of jobs still in the group. |dispatcher_| may only be used while
+  // there are any.
+  int job_count_ = 0;
+  bool abandoned_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(CompilerDispatcherJobGroup);
+};
+
 // The CompilerDispatcher uses a combination of idle tasks and background tasks
 // to parse and compile lazily parsed functions.
 //
@@ -84,9 +116,12 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // Returns true if the compiler dispatcher is enabled.
   bool IsEnabled() const;
 
-  base::Optional<JobId> Enqueue(const ParseInfo* outer_parse_info,
-                                const AstRawString* function_name,
-                                const FunctionLiteral* function_literal);
+  // Enqueues a job for |function_literal|. If |group| is given, the job is
+  // aborted when the group is abandoned before the job is registered.
+  base::Optional<JobId> Enqueue(
+      const ParseInfo* outer_parse_info, const AstRawString* function_name,
+      const FunctionLiteral* function_literal,
+      std::shared_ptr<CompilerDispatcherJobGroup> group = nullptr);
 
   // Registers the given |function| with the compilation job |job_id|.
   void RegisterSharedFunctionInfo(JobId job_id, SharedFunctionInfo function);
@@ -108,6 +143,7 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   void AbortAll();
 
  private:
+  friend class CompilerDispatcherJobGroup;
   FRIEND_TEST(CompilerDispatcherTest, IdleTaskNoIdleTime);
   FRIEND_TEST(CompilerDispatcherTest, IdleTaskSmallIdleTime);
   FRIEND_TEST(CompilerDispatcherTest, FinishNowWithWorkerTask);
@@ -130,8 +166,13 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
       return IsReadyToFinalize(lock);
     }
 
+    // Removes the job from its group, if any. Must not be called while
+    // holding the dispatcher's mutex.
+    void ReleaseGroup();
+
     std::unique_ptr<BackgroundCompileTask> task;
     MaybeHandle<SharedFunctionInfo> function;
+    std::shared_ptr<CompilerDispatcherJobGroup> group;
     bool has_run;
     bool aborted;
   };
@@ -149,6 +190,12 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   JobMap::const_iterator InsertJob(std::unique_ptr<Job> job);
   // Returns iterator following the removed job.
   JobMap::const_iterator RemoveJob(JobMap::const_iterator job);
+  // Moves jobs enqueued from background threads into |jobs_|.
+  void AdoptOffThreadJobs();
+  // Called from any thread when a job group with jobs is abandoned.
+  void ScheduleAbortOfAbandonedJobs();
+  // Aborts the jobs whose group was abandoned.
+  void AbortAbandonedJobs();
 
   Isolate* isolate_;
   AccountingAllocator* allocator_;
@@ -163,9 +210,6 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
 
   std::unique_ptr<CancelableTaskManager> task_manager_;
 
-  // Id for next job to be added
-  JobId next_job_id_;
-
   // Mapping from job_id to job.
   JobMap jobs_;
 
@@ -177,6 +221,13 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // the mutex |mutex_| while accessing them.
   base::Mutex mutex_;
 
+  // Id for next job to be added
+  JobId next_job_id_;
+
+  // Jobs enqueued from background threads that still have to be moved into
+  // |jobs_| on the main thread.
+  JobMap off_thread_jobs_;
+
   // True if an idle task is scheduled to be run.
   bool idle_task_scheduled_;
 
@@ -101,18 +101,23 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
     DCHECK_EQ(0, ref_count_);
   }
 #endif
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK(input_queue_.empty());
 }
 
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     bool check_if_flushing) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  if (input_queue_.empty()) return nullptr;
+  InputQueueEntry entry = input_queue_.top();
+  input_queue_.pop();
+  OptimizedCompilationJob* job = entry.job;
   DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  if (base::TimeTicks::IsHighResolution()) {
+    isolate_->counters()->turbofan_optimize_concurrent_queue_wait()->AddSample(
+        static_cast<int>(
+            (base::TimeTicks::HighResolutionNow() - entry.queued_at)
+                .InMicroseconds()));
+  }
   if (check_if_flushing) {
     if (mode_ == FLUSH) {
       AllowHandleDereference allow_handle_dereference;
@@ -159,11 +164,10 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   if (blocking_behavior == BlockingBehavior::kDontBlock) {
     if (FLAG_block_concurrent_recompilation) Unblock();
     base::MutexGuard access_input_queue_(&input_queue_mutex_);
-    while (input_queue_length_ > 0) {
-      OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+    while (!input_queue_.empty()) {
+      OptimizedCompilationJob* job = input_queue_.top().job;
       DCHECK_NOT_NULL(job);
-      input_queue_shift_ = InputQueueIndex(1);
-      input_queue_length_--;
+      input_queue_.pop();
       DisposeCompilationJob(job, true);
     }
     FlushOutputQueue(true);
@@ -196,8 +200,8 @@ void OptimizingCompileDispatcher::Stop() {
 
   if (recompilation_delay_ != 0) {
     // At this point the optimizing compiler thread's event loop has stopped.
-    // There is no need for a mutex when reading input_queue_length_.
-    while (input_queue_length_ > 0) CompileNext(NextInput());
+    // There is no need for a mutex when reading input_queue_.
+    while (!input_queue_.empty()) CompileNext(NextInput());
     InstallOptimizedFunctions();
   } else {
     FlushOutputQueue(false);
@@ -231,14 +235,19 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
 }
 
 void OptimizingCompileDispatcher::QueueForOptimization(
-    OptimizedCompilationJob* job) {
+    OptimizedCompilationJob* job, int priority) {
   DCHECK(IsQueueAvailable());
+  // OSR jobs are requested by code that is running hot right now.
+  if (job->compilation_info()->is_osr()) priority = kMaxInt;
   {
-    // Add job to the back of the input queue.
+    // Add job to the input queue, ordered by priority.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
+    DCHECK_LT(static_cast<int>(input_queue_.size()), input_queue_capacity_);
+    input_queue_.push({job, priority, next_sequence_number_++,
+                       base::TimeTicks::HighResolutionNow()});
+    Counters* const counters = isolate_->counters();
+    counters->turbofan_optimize_concurrent_queue_length()->AddSample(
+        static_cast<int>(input_queue_.size()));
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
@@ -7,13 +7,16 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
@@ -26,54 +29,64 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   explicit OptimizingCompileDispatcher(Isolate* isolate)
       : isolate_(isolate),
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
+        next_sequence_number_(0),
         mode_(COMPILE),
         blocked_jobs_(0),
         ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
-  }
+        recompilation_delay_(FLAG_concurrent_recompilation_delay) {}
 
   ~OptimizingCompileDispatcher();
 
   void Stop();
   void Flush(BlockingBehavior blocking_behavior);
-  // Takes ownership of |job|.
-  void QueueForOptimization(OptimizedCompilationJob* job);
+  // Takes ownership of |job|. Pending jobs with a higher |priority|, e.g. of a
+  // hotter function, are compiled first. OSR jobs are always compiled before
+  // any other pending job.
+  void QueueForOptimization(OptimizedCompilationJob* job, int priority = 0);
   void Unblock();
   void InstallOptimizedFunctions();
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    return static_cast<int>(input_queue_.size()) < input_queue_capacity_;
   }
 
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
+  FRIEND_TEST(OptimizingCompileDispatcherTest, CompileHotterJobsFirst);
+
   class CompileTask;
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    int priority;
+    // Breaks ties between jobs of equal priority in FIFO order.
+    uint64_t sequence_number;
+    base::TimeTicks queued_at;
+  };
+
+  struct InputQueueEntryLess {
+    bool operator()(const InputQueueEntry& a, const InputQueueEntry& b) const {
+      if (a.priority != b.priority) return a.priority < b.priority;
+      return a.sequence_number > b.sequence_number;
+    }
+  };
+
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job);
   OptimizedCompilationJob* NextInput(bool check_if_flushing = false);
 
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
-
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  // Priority queue of incoming recompilation tasks (including OSR).
+  std::priority_queue<InputQueueEntry, std::vector<InputQueueEntry>,
+                      InputQueueEntryLess>
+      input_queue_;
   int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
+  uint64_t next_sequence_number_;
   base::Mutex input_queue_mutex_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
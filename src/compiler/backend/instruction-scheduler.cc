@@ -58,11 +58,12 @@ InstructionScheduler::StressSchedulerQueue::PopBestCandidate(int cycle) {
 }
 
 InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(Zone* zone,
-                                                           Instruction* instr)
+                                                           Instruction* instr,
+                                                           int latency)
     : instr_(instr),
       successors_(zone),
       unscheduled_predecessors_count_(0),
-      latency_(GetInstructionLatency(instr)),
+      latency_(latency),
       total_latency_(-1),
       start_cycle_(-1) {}
 
@@ -72,6 +73,18 @@ void InstructionScheduler::ScheduleGraphNode::AddSuccessor(
   node->unscheduled_predecessors_count_++;
 }
 
+namespace {
+
+bool CanUseHostLatencies(Isolate* isolate) {
+  if (FLAG_predictable) return false;
+  // Wasm code is never serialized for other machines.
+  if (isolate == nullptr) return true;
+  return !isolate->serializer_enabled() &&
+         !isolate->IsGeneratingEmbeddedBuiltins();
+}
+
+}  // namespace
+
 InstructionScheduler::InstructionScheduler(Zone* zone,
                                            InstructionSequence* sequence)
     : zone_(zone),
@@ -81,7 +94,8 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
       last_deopt_or_trap_(nullptr),
-      operands_map_(zone) {}
+      operands_map_(zone),
+      use_host_latencies_(CanUseHostLatencies(sequence->isolate())) {}
 
 void InstructionScheduler::StartBlock(RpoNumber rpo) {
   DCHECK(graph_.empty());
@@ -109,7 +123,8 @@ void InstructionScheduler::EndBlock(RpoNumber rpo) {
 }
 
 void InstructionScheduler::AddTerminator(Instruction* instr) {
-  ScheduleGraphNode* new_node = new (zone()) ScheduleGraphNode(zone(), instr);
+  ScheduleGraphNode* new_node = new (zone())
+      ScheduleGraphNode(zone(), instr, GetInstructionLatency(instr));
   // Make sure that basic block terminators are not moved by adding them
   // as successor of every instruction.
   for (ScheduleGraphNode* node : graph_) {
@@ -119,7 +134,8 @@ void InstructionScheduler::AddTerminator(Instruction* instr) {
 }
 
 void InstructionScheduler::AddInstruction(Instruction* instr) {
-  ScheduleGraphNode* new_node = new (zone()) ScheduleGraphNode(zone(), instr);
+  ScheduleGraphNode* new_node = new (zone())
+      ScheduleGraphNode(zone(), instr, GetInstructionLatency(instr));
 
   // We should not have branches in the middle of a block.
   DCHECK_NE(instr->flags_mode(), kFlags_branch);
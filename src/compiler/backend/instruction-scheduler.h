@@ -44,7 +44,7 @@ class InstructionScheduler final : public ZoneObject {
   // Represent an instruction and their dependencies.
   class ScheduleGraphNode : public ZoneObject {
    public:
-    ScheduleGraphNode(Zone* zone, Instruction* instr);
+    ScheduleGraphNode(Zone* zone, Instruction* instr, int latency);
 
     // Mark the instruction represented by 'node' as a dependecy of this one.
     // The current instruction will be registered as an unscheduled predecessor
@@ -189,7 +189,14 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
-  static int GetInstructionLatency(const Instruction* instr);
+  // Return the estimated latency of the given instruction in cycles.
+  int GetInstructionLatency(const Instruction* instr);
+
+  // Whether the latencies may be tuned for the CPU we are running on. Code
+  // that is compiled with --predictable, or that ends up in a snapshot or in
+  // the embedded builtins and thus runs on other machines, is always scheduled
+  // the same way.
+  bool use_host_latencies() const { return use_host_latencies_; }
 
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
@@ -200,6 +207,7 @@ class InstructionScheduler final : public ZoneObject {
   ZoneVector<ScheduleGraphNode*> graph_;
 
   friend class InstructionSchedulerTester;
+  friend class InstructionSchedulerX64Test;
 
   // Last side effect instruction encountered while building the graph.
   ScheduleGraphNode* last_side_effect_instr_;
@@ -223,6 +231,8 @@ class InstructionScheduler final : public ZoneObject {
   // Keep track of definition points for virtual registers. This is used to
   // record operand dependencies in the scheduling graph.
   ZoneMap<int32_t, ScheduleGraphNode*> operands_map_;
+
+  const bool use_host_latencies_;
 };
 
 }  // namespace compiler
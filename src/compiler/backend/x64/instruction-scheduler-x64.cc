@@ -4,6 +4,10 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <cstring>
+
+#include "src/base/cpu.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -380,16 +384,93 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Latencies (in cycles) of the x64 instructions that are slower than a
+// simple ALU operation. The numbers are taken from the vendor optimization
+// manuals and published measurements; where the latency depends on the
+// operands, we use the common case for JavaScript and Wasm code.
+struct X64Latencies {
+  int float_add;       // addsd/subsd, comparisons, min/max, abs/neg.
+  int float32_mul;     // mulss and float32 <-> float64 conversions.
+  int float64_mul;     // mulsd.
+  int float_convert;   // float -> int32 conversions and rounding.
+  int float_to_int64;  // float -> int64 conversions.
+  int float_div_sqrt;  // divss/divsd/sqrtss/sqrtsd.
+  int imul;
+  int idiv;
+  int idiv32;
+  int udiv;
+  int udiv32;
+};
+
+// Used when we do not know better. These values were determined empirically
+// on older Intel cores.
+constexpr X64Latencies kGenericLatencies = {3, 4, 5, 4, 10, 13, 3,
+                                            49, 35, 38, 26};
+
+// Intel Skylake to Comet Lake.
+constexpr X64Latencies kSkylakeLatencies = {4, 4, 4, 5, 6, 14, 3,
+                                            42, 26, 35, 26};
+
+// Intel Ice Lake and later, which have a much faster integer divider.
+constexpr X64Latencies kIceLakeLatencies = {4, 4, 4, 5, 6, 14, 3,
+                                            15, 12, 15, 12};
+
+// AMD Zen and Zen 2.
+constexpr X64Latencies kZenLatencies = {3, 3, 4, 4, 7, 13, 3,
+                                        45, 30, 45, 30};
+
+// AMD Zen 3 and later.
+constexpr X64Latencies kZen3Latencies = {3, 3, 3, 4, 7, 13, 3,
+                                         18, 12, 18, 12};
+
+const X64Latencies& SelectLatencies() {
+  base::CPU cpu;
+  int family = cpu.family();
+  if (family == 0xF) family += cpu.ext_family();
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && family == 0x6) {
+    switch (cpu.model()) {
+      case 0x4E:  // Skylake mobile.
+      case 0x5E:  // Skylake desktop.
+      case 0x55:  // Skylake server, Cascade Lake.
+      case 0x8E:  // Kaby Lake, Coffee Lake, Whiskey Lake mobile.
+      case 0x9E:  // Kaby Lake, Coffee Lake desktop.
+      case 0xA5:  // Comet Lake.
+      case 0xA6:  // Comet Lake mobile.
+        return kSkylakeLatencies;
+      case 0x6A:  // Ice Lake server.
+      case 0x6C:  // Ice Lake server.
+      case 0x7D:  // Ice Lake desktop.
+      case 0x7E:  // Ice Lake mobile.
+      case 0x8C:  // Tiger Lake mobile.
+      case 0x8D:  // Tiger Lake desktop.
+        return kIceLakeLatencies;
+      default:
+        return kGenericLatencies;
+    }
+  }
+  if (strcmp(cpu.vendor(), "AuthenticAMD") == 0) {
+    if (family >= 0x19) return kZen3Latencies;
+    if (family == 0x17) return kZenLatencies;
+  }
+  return kGenericLatencies;
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  static const X64Latencies& host_latencies = SelectLatencies();
+  const X64Latencies& latencies =
+      use_host_latencies() ? host_latencies : kGenericLatencies;
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
-      return 5;
+      return latencies.float64_mul;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
+      return latencies.imul;
     case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
@@ -402,35 +483,36 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Min:
     case kSSEFloat64Abs:
     case kSSEFloat64Neg:
-      return 3;
+      return latencies.float_add;
     case kSSEFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
+      return latencies.float32_mul;
     case kSSEFloat32Round:
     case kSSEFloat64Round:
     case kSSEFloat32ToInt32:
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+      return latencies.float_convert;
     case kX64Idiv:
-      return 49;
+      return latencies.idiv;
     case kX64Idiv32:
-      return 35;
+      return latencies.idiv32;
     case kX64Udiv:
-      return 38;
+      return latencies.udiv;
     case kX64Udiv32:
-      return 26;
+      return latencies.udiv32;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
-      return 13;
+      return latencies.float_div_sqrt;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
-      return 10;
+      return latencies.float_to_int64;
     case kSSEFloat64Mod:
       return 50;
     case kArchTruncateDoubleToI:
@@ -7,19 +7,22 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/compiler/type-cache.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
 BranchElimination::BranchElimination(Editor* editor, JSGraph* js_graph,
-                                     Zone* zone)
+                                     Zone* zone,
+                                     PoisoningMitigationLevel poisoning_level)
     : AdvancedReducer(editor),
       jsgraph_(js_graph),
       node_conditions_(js_graph->graph()->NodeCount(), zone),
       reduced_(js_graph->graph()->NodeCount(), zone),
       zone_(zone),
-      dead_(js_graph->Dead()) {}
+      dead_(js_graph->Dead()),
+      poisoning_level_(poisoning_level) {}
 
 BranchElimination::~BranchElimination() = default;
 
@@ -37,6 +40,8 @@ Reduction BranchElimination::Reduce(Node* node) {
       return ReduceLoop(node);
     case IrOpcode::kBranch:
       return ReduceBranch(node);
+    case IrOpcode::kCheckBounds:
+      return ReduceCheckBounds(node);
     case IrOpcode::kIfFalse:
       return ReduceIf(node, false);
     case IrOpcode::kIfTrue:
@@ -90,6 +95,82 @@ Reduction BranchElimination::ReduceBranch(Node* node) {
   return TakeConditionsFromFirstControl(node);
 }
 
+Reduction BranchElimination::ReduceCheckBounds(Node* node) {
+  Node* index = NodeProperties::GetValueInput(node, 0);
+  Node* length = NodeProperties::GetValueInput(node, 1);
+  Node* control = NodeProperties::GetControlInput(node);
+  if (!reduced_.Get(control)) return NoChange();
+  // The dominating branch may be mispredicted, so only drop the check when
+  // we don't poison loads anyway. This matches SimplifiedLowering, which only
+  // turns a CheckBounds into an abort then.
+  if (poisoning_level_ != PoisoningMitigationLevel::kDontPoison) {
+    return NoChange();
+  }
+  if (!NodeProperties::IsTyped(node) || !NodeProperties::IsTyped(index)) {
+    return NoChange();
+  }
+
+  // The bounds check is redundant if {index} is a non-negative integer and a
+  // dominating branch established that it is less than {length}. This is
+  // typically the case in loops of the form
+  //
+  //   for (let i = 0; i < a.length; i++) a[i];
+  //
+  // once load elimination has unified the two loads of the length. The
+  // {index} must not be -0 though, since CheckBounds identifies -0 with 0
+  // and its type does not include -0.
+  Type index_type = NodeProperties::GetType(index);
+  if (!index_type.Is(TypeCache::Get()->kPositiveInteger)) {
+    return NoChange();
+  }
+  if (!IsKnownLessThan(node_conditions_.Get(control), index, length)) {
+    return NoChange();
+  }
+
+  // Keep the type that the bounds check established for the index.
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* value =
+      graph()->NewNode(common()->TypeGuard(NodeProperties::GetType(node)),
+                       index, effect, control);
+  NodeProperties::SetType(value, NodeProperties::GetType(node));
+  ReplaceWithValue(node, value, value, control);
+  return Replace(value);
+}
+
+bool BranchElimination::IsKnownLessThan(ControlPathConditions conditions,
+                                        Node* lhs, Node* rhs) {
+  for (Node* use : lhs->uses()) {
+    bool expected_value;
+    switch (use->opcode()) {
+      case IrOpcode::kNumberLessThan:
+      case IrOpcode::kSpeculativeNumberLessThan:
+        // lhs < rhs is true.
+        if (use->InputAt(0) != lhs || use->InputAt(1) != rhs) continue;
+        expected_value = true;
+        break;
+      case IrOpcode::kNumberLessThanOrEqual:
+      case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+        // rhs <= lhs is false, and rhs is not NaN.
+        if (use->InputAt(0) != rhs || use->InputAt(1) != lhs) continue;
+        if (!NodeProperties::IsTyped(rhs) ||
+            !NodeProperties::GetType(rhs).Is(Type::OrderedNumber())) {
+          continue;
+        }
+        expected_value = false;
+        break;
+      default:
+        continue;
+    }
+    Node* branch;
+    bool condition_value;
+    if (conditions.LookupCondition(use, &branch, &condition_value) &&
+        condition_value == expected_value) {
+      return true;
+    }
+  }
+  return false;
+}
+
 Reduction BranchElimination::ReduceDeoptimizeConditional(Node* node) {
   DCHECK(node->opcode() == IrOpcode::kDeoptimizeIf ||
          node->opcode() == IrOpcode::kDeoptimizeUnless);
@@ -22,7 +22,9 @@ class JSGraph;
 class V8_EXPORT_PRIVATE BranchElimination final
     : public NON_EXPORTED_BASE(AdvancedReducer) {
  public:
-  BranchElimination(Editor* editor, JSGraph* js_graph, Zone* zone);
+  BranchElimination(Editor* editor, JSGraph* js_graph, Zone* zone,
+                    PoisoningMitigationLevel poisoning_level =
+                        PoisoningMitigationLevel::kPoisonAll);
   ~BranchElimination() final;
 
   const char* reducer_name() const override { return "BranchElimination"; }
@@ -56,6 +58,7 @@ class V8_EXPORT_PRIVATE BranchElimination final
   };
 
   Reduction ReduceBranch(Node* node);
+  Reduction ReduceCheckBounds(Node* node);
   Reduction ReduceDeoptimizeConditional(Node* node);
   Reduction ReduceIf(Node* node, bool is_true_branch);
   Reduction ReduceLoop(Node* node);
@@ -68,6 +71,7 @@ class V8_EXPORT_PRIVATE BranchElimination final
   Reduction UpdateConditions(Node* node, ControlPathConditions prev_conditions,
                              Node* current_condition, Node* current_branch,
                              bool is_true_branch);
+  bool IsKnownLessThan(ControlPathConditions conditions, Node* lhs, Node* rhs);
 
   Node* dead() const { return dead_; }
   Graph* graph() const;
@@ -84,6 +88,7 @@ class V8_EXPORT_PRIVATE BranchElimination final
   NodeAuxData<bool> reduced_;
   Zone* zone_;
   Node* dead_;
+  PoisoningMitigationLevel poisoning_level_;
 };
 
 }  // namespace compiler
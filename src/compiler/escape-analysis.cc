@@ -4,6 +4,7 @@
 
 #include "src/compiler/escape-analysis.h"
 
+#include "src/base/small-vector.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/operator-properties.h"
@@ -199,6 +200,8 @@ class EscapeAnalysisTracker : public ZoneObject {
       vobject_ = tracker_->virtual_objects_.Get(object);
     }
 
+    Node* CurrentNode() const { return current_node(); }
+
     void SetEscaped(Node* node) {
       if (VirtualObject* object = tracker_->virtual_objects_.Get(node)) {
         if (object->HasEscaped()) return;
@@ -219,6 +222,10 @@ class EscapeAnalysisTracker : public ZoneObject {
       return tracker_->ResolveReplacement(
           NodeProperties::GetContextInput(current_node()));
     }
+    // Same for nodes further up the graph.
+    Node* ResolveReplacement(Node* node) {
+      return tracker_->ResolveReplacement(node);
+    }
 
     void SetReplacement(Node* replacement) {
       replacement_ = replacement;
@@ -545,6 +552,44 @@ Node* LowerCompareMapsWithoutLoad(Node* checked_map,
   return replacement;
 }
 
+// Returns the only non-phi value that flows into the phis reachable from
+// {phi} through value inputs, or nullptr if there is more than one such value
+// or the phi web is too big to be worth looking at. The values are compared
+// after resolving their replacements, e.g. a load of the object from another
+// virtual object counts as the object itself.
+Node* SingleNonPhiInput(Node* phi, EscapeAnalysisTracker::Scope* current) {
+  static const size_t kMaxPhiWebSize = 16;
+  base::SmallVector<Node*, 8> visited;
+  base::SmallVector<Node*, 8> stack;
+  Node* result = nullptr;
+  visited.emplace_back(phi);
+  stack.emplace_back(phi);
+  while (!stack.empty()) {
+    Node* node = stack.back();
+    stack.pop_back();
+    int value_input_count = node->op()->ValueInputCount();
+    for (int i = 0; i < value_input_count; ++i) {
+      Node* input = NodeProperties::GetValueInput(node, i);
+      if (input->opcode() == IrOpcode::kPhi) {
+        if (std::find(visited.begin(), visited.end(), input) != visited.end()) {
+          continue;
+        }
+        if (visited.size() == kMaxPhiWebSize) return nullptr;
+        visited.emplace_back(input);
+        stack.emplace_back(input);
+        continue;
+      }
+      input = current->ResolveReplacement(input);
+      if (result == nullptr) {
+        result = input;
+      } else if (result != input) {
+        return nullptr;
+      }
+    }
+  }
+  return result;
+}
+
 void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
                 JSGraph* jsgraph) {
   switch (op->opcode()) {
@@ -685,6 +730,23 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       current->SetVirtualObject(current->ValueInput(0));
       break;
     }
+    case IrOpcode::kPhi: {
+      // A web of phis that only ever merges one virtual object, for example a
+      // loop variable that is carried around the back-edge unchanged, is just
+      // that object and does not need to force it to escape.
+      Node* object = SingleNonPhiInput(current->CurrentNode(), current);
+      const VirtualObject* vobject =
+          object ? current->GetVirtualObject(object) : nullptr;
+      if (vobject && !vobject->HasEscaped()) {
+        current->SetReplacement(object);
+      } else {
+        int value_input_count = op->ValueInputCount();
+        for (int i = 0; i < value_input_count; ++i) {
+          current->SetEscaped(current->ValueInput(i));
+        }
+      }
+      break;
+    }
     case IrOpcode::kReferenceEqual: {
       Node* left = current->ValueInput(0);
       Node* right = current->ValueInput(1);
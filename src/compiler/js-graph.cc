@@ -138,6 +138,8 @@ DEFINE_GETTER(BigIntMapConstant, HeapConstant(factory()->bigint_map()))
 
 DEFINE_GETTER(BooleanMapConstant, HeapConstant(factory()->boolean_map()))
 
+DEFINE_GETTER(ConsStringMapConstant, HeapConstant(factory()->cons_string_map()))
+
 DEFINE_GETTER(ToNumberBuiltinConstant,
               HeapConstant(BUILTIN_CODE(isolate(), ToNumber)))
 
@@ -86,6 +86,7 @@ class V8_EXPORT_PRIVATE JSGraph : public MachineGraph {
   V(ArrayConstructorStubConstant)          \
   V(BigIntMapConstant)                     \
   V(BooleanMapConstant)                    \
+  V(ConsStringMapConstant)                 \
   V(ToNumberBuiltinConstant)               \
   V(EmptyFixedArrayConstant)               \
   V(EmptyStringConstant)                   \
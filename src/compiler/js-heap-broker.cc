@@ -2083,6 +2083,7 @@ void JSHeapBroker::SerializeStandardObjects() {
   GetOrCreateData(f->boolean_map());
   GetOrCreateData(f->boolean_string());
   GetOrCreateData(f->catch_context_map());
+  GetOrCreateData(f->cons_string_map());
   GetOrCreateData(f->empty_fixed_array());
   GetOrCreateData(f->empty_string());
   GetOrCreateData(f->eval_context_map());
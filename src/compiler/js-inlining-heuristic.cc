@@ -227,11 +227,9 @@ void JSInliningHeuristic::Finalize() {
     }
 
     // Make sure we have some extra budget left, so that any small functions
-    // exposed by this function would be given a chance to inline.
-    double size_of_candidate =
-        candidate.total_size * FLAG_reserve_inline_budget_scale_factor;
-    int total_size = cumulative_count_ + static_cast<int>(size_of_candidate);
-    if (total_size > FLAG_max_inlined_bytecode_size_cumulative) {
+    // exposed by this function would be given a chance to inline. For
+    // polymorphic call sites, inline as many of the targets as fit.
+    if (!TrimCandidateToBudget(&candidate)) {
       // Try if any smaller functions are available to inline.
       continue;
     }
@@ -711,6 +709,35 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   return Replace(value);
 }
 
+bool JSInliningHeuristic::TrimCandidateToBudget(Candidate* candidate) const {
+  while (true) {
+    double size_of_candidate =
+        candidate->total_size * FLAG_reserve_inline_budget_scale_factor;
+    int total_size = cumulative_count_ + static_cast<int>(size_of_candidate);
+    if (total_size <= FLAG_max_inlined_bytecode_size_cumulative) return true;
+    if (candidate->num_functions == 1) return false;
+
+    // Without per-target call counts, we keep the smallest targets, which
+    // save the most call overhead per inlined bytecode. The dropped targets
+    // are still dispatched to directly.
+    int biggest = -1;
+    int inlineable_count = 0;
+    for (int i = 0; i < candidate->num_functions; ++i) {
+      if (!candidate->can_inline_function[i]) continue;
+      inlineable_count++;
+      if (biggest == -1 || candidate->bytecode[i]->length() >
+                               candidate->bytecode[biggest]->length()) {
+        biggest = i;
+      }
+    }
+    if (inlineable_count <= 1) return false;
+    TRACE("Not inlining target %d of call site #%d:%s, because of budget\n",
+          biggest, candidate->node->id(), candidate->node->op()->mnemonic());
+    candidate->can_inline_function[biggest] = false;
+    candidate->total_size -= candidate->bytecode[biggest]->length();
+  }
+}
+
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
   if (right.frequency.IsUnknown()) {
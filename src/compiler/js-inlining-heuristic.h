@@ -70,6 +70,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
   // Dumps candidates to console.
   void PrintCandidates();
   Reduction InlineCandidate(Candidate const& candidate, bool small_function);
+  // Drops the biggest targets of a polymorphic {candidate} until the rest
+  // fits into the remaining inlining budget. Returns false if nothing fits.
+  bool TrimCandidateToBudget(Candidate* candidate) const;
   void CreateOrReuseDispatch(Node* node, Node* callee,
                              Candidate const& candidate, Node** if_successes,
                              Node** calls, Node** inputs, int input_count);
@@ -71,6 +71,7 @@
 #include "src/compiler/simplified-operator-reducer.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/store-store-elimination.h"
+#include "src/compiler/string-accumulation.h"
 #include "src/compiler/type-narrowing-reducer.h"
 #include "src/compiler/typed-optimization.h"
 #include "src/compiler/typer.h"
@@ -1343,6 +1344,21 @@ struct LoopExitEliminationPhase {
   }
 };
 
+struct StringAccumulationPhase {
+  static const char* phase_name() { return "V8.TFStringAccumulation"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
+
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(data->jsgraph()->graph(), temp_zone);
+    StringAccumulation(data->jsgraph(), loop_tree, temp_zone).Run();
+  }
+};
+
 struct GenericLoweringPhase {
   static const char* phase_name() { return "V8.TFGenericLowering"; }
 
@@ -1467,8 +1483,9 @@ struct LoadEliminationPhase {
   void Run(PipelineData* data, Zone* temp_zone) {
     GraphReducer graph_reducer(temp_zone, data->graph(),
                                data->jsgraph()->Dead());
-    BranchElimination branch_condition_elimination(&graph_reducer,
-                                                   data->jsgraph(), temp_zone);
+    BranchElimination branch_condition_elimination(
+        &graph_reducer, data->jsgraph(), temp_zone,
+        data->info()->GetPoisoningMitigationLevel());
     DeadCodeElimination dead_code_elimination(&graph_reducer, data->graph(),
                                               data->common(), temp_zone);
     RedundancyElimination redundancy_elimination(&graph_reducer, temp_zone);
@@ -1526,8 +1543,9 @@ struct LateOptimizationPhase {
   void Run(PipelineData* data, Zone* temp_zone) {
     GraphReducer graph_reducer(temp_zone, data->graph(),
                                data->jsgraph()->Dead());
-    BranchElimination branch_condition_elimination(&graph_reducer,
-                                                   data->jsgraph(), temp_zone);
+    BranchElimination branch_condition_elimination(
+        &graph_reducer, data->jsgraph(), temp_zone,
+        data->info()->GetPoisoningMitigationLevel());
     DeadCodeElimination dead_code_elimination(&graph_reducer, data->graph(),
                                               data->common(), temp_zone);
     ValueNumberingReducer value_numbering(temp_zone, data->graph()->zone());
@@ -1573,8 +1591,9 @@ struct CsaEarlyOptimizationPhase {
   void Run(PipelineData* data, Zone* temp_zone) {
     GraphReducer graph_reducer(temp_zone, data->graph(),
                                data->jsgraph()->Dead());
-    BranchElimination branch_condition_elimination(&graph_reducer,
-                                                   data->jsgraph(), temp_zone);
+    BranchElimination branch_condition_elimination(
+        &graph_reducer, data->jsgraph(), temp_zone,
+        data->info()->GetPoisoningMitigationLevel());
     DeadCodeElimination dead_code_elimination(&graph_reducer, data->graph(),
                                               data->common(), temp_zone);
     CommonOperatorReducer common_reducer(&graph_reducer, data->graph(),
@@ -1598,8 +1617,9 @@ struct CsaOptimizationPhase {
   void Run(PipelineData* data, Zone* temp_zone) {
     GraphReducer graph_reducer(temp_zone, data->graph(),
                                data->jsgraph()->Dead());
-    BranchElimination branch_condition_elimination(&graph_reducer,
-                                                   data->jsgraph(), temp_zone);
+    BranchElimination branch_condition_elimination(
+        &graph_reducer, data->jsgraph(), temp_zone,
+        data->info()->GetPoisoningMitigationLevel());
     DeadCodeElimination dead_code_elimination(&graph_reducer, data->graph(),
                                               data->common(), temp_zone);
     MachineOperatorReducer machine_reducer(&graph_reducer, data->jsgraph());
@@ -2099,6 +2119,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify(LoopExitEliminationPhase::phase_name(), true);
   }
 
+  if (FLAG_turbo_string_accumulation) {
+    Run<StringAccumulationPhase>();
+    RunPrintAndVerify(StringAccumulationPhase::phase_name());
+  }
+
   if (FLAG_turbo_load_elimination) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
@@ -2631,6 +2656,17 @@ void PipelineImpl::ComputeScheduledGraph() {
   TraceSchedule(data->info(), data, data->schedule(), "schedule");
 }
 
+namespace {
+
+bool UseFastRegisterAllocation(const InstructionSequence* sequence) {
+  if (FLAG_turbo_fast_register_allocation) return true;
+  return FLAG_turbo_fast_register_allocation_threshold > 0 &&
+         sequence->instructions().size() >
+             FLAG_turbo_fast_register_allocation_threshold;
+}
+
+}  // namespace
+
 bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   auto call_descriptor = linkage->GetIncomingDescriptor();
   PipelineData* data = this->data_;
@@ -2709,7 +2745,11 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   data->DeleteGraphZone();
 
-  data->BeginPhaseKind("V8.TFRegisterAllocation");
+  // Report the fast mode as its own phase kind, so that --turbo-stats shows
+  // its compile time and zone usage separately from the regular allocator.
+  data->BeginPhaseKind(UseFastRegisterAllocation(data->sequence())
+                           ? "V8.TFFastRegisterAllocation"
+                           : "V8.TFRegisterAllocation");
 
   bool run_verifier = FLAG_turbo_verify_allocation;
 
@@ -2951,11 +2991,26 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   data_->sequence()->ValidateDeferredBlockExitPaths();
 #endif
 
+  // Very large functions spend most of their compile time in the allocator.
+  // For them, skip bundling, splintering and move optimization and run a
+  // plain linear scan, trading some code quality for compile time.
+  const bool fast_allocation = UseFastRegisterAllocation(data->sequence());
+  const bool preprocess_ranges =
+      !fast_allocation && data->info()->is_turbo_preprocess_ranges();
+  if (fast_allocation && info()->trace_turbo_graph_enabled()) {
+    CodeTracer::Scope tracing_scope(data->GetCodeTracer());
+    OFStream os(tracing_scope.file());
+    os << "Using fast register allocation for "
+       << data->sequence()->instructions().size() << " instructions"
+       << std::endl;
+  }
+
   RegisterAllocationFlags flags;
-  if (data->info()->is_turbo_control_flow_aware_allocation()) {
+  if (!fast_allocation &&
+      data->info()->is_turbo_control_flow_aware_allocation()) {
     flags |= RegisterAllocationFlag::kTurboControlFlowAwareAllocation;
   }
-  if (data->info()->is_turbo_preprocess_ranges()) {
+  if (preprocess_ranges) {
     flags |= RegisterAllocationFlag::kTurboPreprocessRanges;
   }
   data->InitializeRegisterAllocationData(config, call_descriptor, flags);
@@ -2964,7 +3019,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<MeetRegisterConstraintsPhase>();
   Run<ResolvePhisPhase>();
   Run<BuildLiveRangesPhase>();
-  Run<BuildBundlesPhase>();
+  if (!fast_allocation) Run<BuildBundlesPhase>();
 
   TraceSequence(info(), data, "before register allocation");
   if (verifier != nullptr) {
@@ -2979,7 +3034,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                        data->register_allocation_data());
   }
 
-  if (info()->is_turbo_preprocess_ranges()) {
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
     if (info()->trace_turbo_json_enabled() &&
         !data->MayHaveUnverifiableGraph()) {
@@ -2995,7 +3050,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
     Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
   }
 
-  if (info()->is_turbo_preprocess_ranges()) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -3015,7 +3070,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<ConnectRangesPhase>();
 
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (FLAG_turbo_move_optimization && !fast_allocation) {
     Run<OptimizeMovesPhase>();
   }
   Run<LocateSpillSlotsPhase>();
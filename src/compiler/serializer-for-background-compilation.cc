@@ -313,21 +313,27 @@ SerializerForBackgroundCompilation::SerializerForBackgroundCompilation(
       zone_(zone),
       environment_(new (zone) Environment(zone, {closure, broker_->isolate()})),
       jump_target_environments_(zone),
-      flags_(flags) {
+      flags_(flags),
+      own_inlining_budget_(FLAG_max_inlined_bytecode_size_absolute),
+      inlining_budget_(&own_inlining_budget_),
+      invocation_frequency_(1.0f) {
   JSFunctionRef(broker, closure).Serialize();
 }
 
 SerializerForBackgroundCompilation::SerializerForBackgroundCompilation(
     JSHeapBroker* broker, CompilationDependencies* dependencies, Zone* zone,
     CompilationSubject function, base::Optional<Hints> new_target,
-    const HintsVector& arguments, SerializerForBackgroundCompilationFlags flags)
+    const HintsVector& arguments, SerializerForBackgroundCompilationFlags flags,
+    int* inlining_budget, float invocation_frequency)
     : broker_(broker),
       dependencies_(dependencies),
       zone_(zone),
       environment_(new (zone) Environment(zone, broker_->isolate(), function,
                                           new_target, arguments)),
       jump_target_environments_(zone),
-      flags_(flags) {
+      flags_(flags),
+      inlining_budget_(inlining_budget),
+      invocation_frequency_(invocation_frequency) {
   DCHECK(!(flags_ & SerializerForBackgroundCompilationFlag::kOsr));
   TraceScope tracer(
       broker_, this,
@@ -339,6 +345,45 @@ SerializerForBackgroundCompilation::SerializerForBackgroundCompilation(
   }
 }
 
+float SerializerForBackgroundCompilation::ComputeCallFrequency(
+    FeedbackSlot slot) const {
+  // Mirrors BytecodeGraphBuilder::ComputeCallFrequency, which provides the
+  // frequencies that the inlining heuristic looks at.
+  if (slot.IsInvalid()) return invocation_frequency_;
+  FeedbackNexus nexus(environment()->function().feedback_vector, slot);
+  float feedback_frequency = nexus.ComputeCallFrequency();
+  if (feedback_frequency == 0.0f) return 0.0f;
+  return feedback_frequency * invocation_frequency_;
+}
+
+bool SerializerForBackgroundCompilation::ConsumeInliningBudget(
+    Handle<JSFunction> function, float frequency) {
+  // The inlining heuristic doesn't consider call sites whose frequency is below
+  // FLAG_min_inlining_frequency, so don't spend any budget on them.
+  if (frequency < FLAG_min_inlining_frequency) {
+    TRACE_BROKER(broker(), "Call frequency too low, not serializing "
+                               << Brief(*function) << "\n");
+    return false;
+  }
+  // The inliner never inlines more than FLAG_max_inlined_bytecode_size_absolute
+  // bytes of bytecode into a single function, so there is no point in spending
+  // main-thread time on serializing candidates beyond that. Functions that were
+  // serialized already are free.
+  SharedFunctionInfoRef shared(broker(),
+                               handle(function->shared(), broker()->isolate()));
+  FeedbackVectorRef feedback_vector(
+      broker(), handle(function->feedback_vector(), broker()->isolate()));
+  if (shared.IsSerializedForCompilation(feedback_vector)) return true;
+  int const size = function->shared().GetBytecodeArray().length();
+  if (size > *inlining_budget_) {
+    TRACE_BROKER(broker(), "Inlining budget exhausted, not serializing "
+                               << Brief(*function) << "\n");
+    return false;
+  }
+  *inlining_budget_ -= size;
+  return true;
+}
+
 bool SerializerForBackgroundCompilation::BailoutOnUninitialized(
     FeedbackSlot slot) {
   DCHECK(!environment()->IsDead());
@@ -687,7 +732,7 @@ void SerializerForBackgroundCompilation::VisitCallWithSpread(
 
 Hints SerializerForBackgroundCompilation::RunChildSerializer(
     CompilationSubject function, base::Optional<Hints> new_target,
-    const HintsVector& arguments, bool with_spread) {
+    const HintsVector& arguments, bool with_spread, float frequency) {
   if (with_spread) {
     DCHECK_LT(0, arguments.size());
     // Pad the missing arguments in case we were called with spread operator.
@@ -702,12 +747,13 @@ Hints SerializerForBackgroundCompilation::RunChildSerializer(
     padded.resize(
         function.blueprint().shared->GetBytecodeArray().parameter_count(),
         Hints(zone()));
-    return RunChildSerializer(function, new_target, padded, false);
+    return RunChildSerializer(function, new_target, padded, false, frequency);
   }
 
   SerializerForBackgroundCompilation child_serializer(
       broker(), dependencies(), zone(), function, new_target, arguments,
-      flags().without(SerializerForBackgroundCompilationFlag::kOsr));
+      flags().without(SerializerForBackgroundCompilationFlag::kOsr),
+      inlining_budget_, frequency);
   return child_serializer.Run();
 }
 
@@ -748,6 +794,7 @@ void SerializerForBackgroundCompilation::ProcessCallOrConstruct(
 
   environment()->accumulator_hints().Clear();
 
+  float const frequency = ComputeCallFrequency(slot);
   for (auto hint : callee.constants()) {
     if (!hint->IsJSFunction()) continue;
 
@@ -763,9 +810,11 @@ void SerializerForBackgroundCompilation::ProcessCallOrConstruct(
     }
 
     if (!shared->IsInlineable() || !function->has_feedback_vector()) continue;
+    if (!ConsumeInliningBudget(function, frequency)) continue;
 
-    environment()->accumulator_hints().Add(RunChildSerializer(
-        {function, broker()->isolate()}, new_target, arguments, with_spread));
+    environment()->accumulator_hints().Add(
+        RunChildSerializer({function, broker()->isolate()}, new_target,
+                           arguments, with_spread, frequency));
   }
 
   for (auto hint : callee.function_blueprints()) {
@@ -780,8 +829,9 @@ void SerializerForBackgroundCompilation::ProcessCallOrConstruct(
     }
 
     if (!shared->IsInlineable()) continue;
-    environment()->accumulator_hints().Add(RunChildSerializer(
-        CompilationSubject(hint), new_target, arguments, with_spread));
+    environment()->accumulator_hints().Add(
+        RunChildSerializer(CompilationSubject(hint), new_target, arguments,
+                           with_spread, frequency));
   }
 }
 
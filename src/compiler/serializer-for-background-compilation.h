@@ -303,9 +303,12 @@ class SerializerForBackgroundCompilation {
       JSHeapBroker* broker, CompilationDependencies* dependencies, Zone* zone,
       CompilationSubject function, base::Optional<Hints> new_target,
       const HintsVector& arguments,
-      SerializerForBackgroundCompilationFlags flags);
+      SerializerForBackgroundCompilationFlags flags, int* inlining_budget,
+      float invocation_frequency);
 
   bool BailoutOnUninitialized(FeedbackSlot slot);
+  float ComputeCallFrequency(FeedbackSlot slot) const;
+  bool ConsumeInliningBudget(Handle<JSFunction> function, float frequency);
 
   void TraverseBytecode();
 
@@ -347,7 +350,8 @@ class SerializerForBackgroundCompilation {
 
   Hints RunChildSerializer(CompilationSubject function,
                            base::Optional<Hints> new_target,
-                           const HintsVector& arguments, bool with_spread);
+                           const HintsVector& arguments, bool with_spread,
+                           float frequency);
 
   // When (forward-)branching bytecodes are encountered, e.g. a conditional
   // jump, we call ContributeToJumpTargetEnvironment to "remember" the current
@@ -371,6 +375,15 @@ class SerializerForBackgroundCompilation {
   Environment* const environment_;
   ZoneUnorderedMap<int, Environment*> jump_target_environments_;
   SerializerForBackgroundCompilationFlags const flags_;
+
+  // Remaining bytecode size of inlining candidates that we are willing to
+  // serialize. The budget is owned by the top-level serializer and shared with
+  // all of its children.
+  int own_inlining_budget_ = 0;
+  int* const inlining_budget_;
+  // How often the function is called per invocation of the top-level function,
+  // computed like the frequencies the inlining heuristic uses.
+  float const invocation_frequency_;
 };
 
 }  // namespace compiler
@@ -4,12 +4,50 @@
 
 #include "src/compiler/state-values-utils.h"
 
+#include "src/compiler/node-properties.h"
 #include "src/utils/bit-vector.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Escape analysis numbers its virtual objects from zero, so the ids of the
+// strings described by ConsStringState are offset to never collide with them.
+const uint32_t kConsStringStateIdOffset = 1u << 31;
+
+}  // namespace
+
+bool IsDeoptimizationOnlyUse(Edge edge) {
+  Node* const user = edge.from();
+  switch (user->opcode()) {
+    case IrOpcode::kFrameState:
+      return edge.index() == kFrameStateLocalsInput ||
+             edge.index() == kFrameStateStackInput;
+    case IrOpcode::kStateValues:
+    case IrOpcode::kTypedStateValues:
+      for (Edge const user_edge : user->use_edges()) {
+        if (!IsDeoptimizationOnlyUse(user_edge)) return false;
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+
+Node* ConsStringState(JSGraph* jsgraph, Node* string, Node* first,
+                      Node* second) {
+  // The id ties all frame state entries for {string} to one object, which
+  // the deoptimizer then allocates only once.
+  uint32_t const id = kConsStringStateIdOffset + string->id();
+  Node* const state = jsgraph->graph()->NewNode(
+      jsgraph->common()->ObjectState(id, 3), jsgraph->ConsStringMapConstant(),
+      first, second);
+  NodeProperties::SetType(state, Type::Internal());
+  return state;
+}
+
 StateValuesCache::StateValuesCache(JSGraph* js_graph)
     : js_graph_(js_graph),
       hash_map_(AreKeysEqual, ZoneHashMap::kDefaultHashMapCapacity,
@@ -19,6 +19,19 @@ namespace compiler {
 
 class Graph;
 
+// Returns true if the value used through {edge} is only ever read by the
+// deoptimizer, i.e. {edge} leads into the locals or the operand stack of frame
+// states, possibly through trees of StateValues. Parameters don't count, the
+// lowering of arguments objects reads them.
+V8_EXPORT_PRIVATE bool IsDeoptimizationOnlyUse(Edge edge);
+
+// Returns an ObjectState node that describes the string {first} + {second} to
+// the deoptimizer, which then only allocates that string when it actually
+// materializes a frame. This stands in for the value of {string} in frame
+// states once {string} itself is no longer computed.
+V8_EXPORT_PRIVATE Node* ConsStringState(JSGraph* jsgraph, Node* string,
+                                        Node* first, Node* second);
+
 class V8_EXPORT_PRIVATE StateValuesCache {
  public:
   explicit StateValuesCache(JSGraph* js_graph);
@@ -0,0 +1,196 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/string-accumulation.h"
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/compiler/state-values-utils.h"
+#include "src/compiler/type-cache.h"
+#include "src/objects/string.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+StringAccumulation::StringAccumulation(JSGraph* jsgraph, LoopTree* loop_tree,
+                                       Zone* zone)
+    : jsgraph_(jsgraph),
+      loop_tree_(loop_tree),
+      node_count_(jsgraph->graph()->NodeCount()),
+      type_cache_(TypeCache::Get()),
+      zone_(zone) {}
+
+void StringAccumulation::Run() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    VisitLoop(loop);
+  }
+}
+
+void StringAccumulation::VisitLoop(LoopTree::Loop* loop) {
+  for (LoopTree::Loop* child : loop->children()) {
+    VisitLoop(child);
+  }
+
+  // Only loops with a single back edge are handled.
+  Node* const loop_node = loop_tree_->GetLoopControl(loop);
+  if (loop_node->InputCount() != 2) return;
+
+  // Collect the candidates first, accumulating adds phis to {loop_node}.
+  NodeVector phis(zone());
+  for (Node* const use : loop_node->uses()) {
+    if (use->opcode() == IrOpcode::kPhi && NodeProperties::IsTyped(use) &&
+        NodeProperties::GetType(use).Is(Type::String())) {
+      phis.push_back(use);
+    }
+  }
+  for (Node* const phi : phis) {
+    TryAccumulate(loop, loop_node, phi);
+  }
+}
+
+bool StringAccumulation::IsReplaceableUse(LoopTree::Loop* loop, Edge edge) {
+  Node* const user = edge.from();
+  if (user->opcode() == IrOpcode::kStringLength) return true;
+  if (IsDeoptimizationOnlyUse(edge)) return true;
+  // Any other use needs the string itself, which must not be allocated on
+  // every iteration.
+  return user->id() < node_count_ && !loop_tree_->Contains(loop, user);
+}
+
+void StringAccumulation::TryAccumulate(LoopTree::Loop* loop, Node* loop_node,
+                                       Node* phi) {
+  Node* const initial = phi->InputAt(0);
+  Node* const next = phi->InputAt(1);
+  if (next->opcode() != IrOpcode::kStringConcat) return;
+  if (NodeProperties::GetValueInput(next, 1) != phi) return;
+  Node* const piece = NodeProperties::GetValueInput(next, 2);
+  if (piece == phi) return;
+  for (Edge const edge : phi->use_edges()) {
+    if (edge.from() == next) continue;
+    if (!IsReplaceableUse(loop, edge)) return;
+  }
+  for (Edge const edge : next->use_edges()) {
+    if (edge.from() == phi) continue;
+    if (!IsReplaceableUse(loop, edge)) return;
+  }
+  TRACE("Accumulating string #%d in loop #%d\n", phi->id(), loop_node->id());
+
+  // s = acc + buf at the loop header.
+  Node* const empty = jsgraph()->EmptyStringConstant();
+  Node* const acc =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                       initial, initial, loop_node);
+  NodeProperties::SetType(acc, Type::String());
+  Node* const buf =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                       empty, empty, loop_node);
+  NodeProperties::SetType(buf, Type::String());
+
+  // s' = acc + t with t = buf + x. Like {next}, {t} is computed on every
+  // iteration, but it is a flat string while it stays in the buffer.
+  Node* const buf_length = graph()->NewNode(simplified()->StringLength(), buf);
+  NodeProperties::SetType(buf_length, type_cache_->kStringLengthType);
+  Node* const piece_length =
+      graph()->NewNode(simplified()->StringLength(), piece);
+  NodeProperties::SetType(piece_length, type_cache_->kStringLengthType);
+  // The sum cannot exceed the length of {next}, which was already checked
+  // against String::kMaxLength.
+  Node* const t_length =
+      graph()->NewNode(simplified()->NumberAdd(), buf_length, piece_length);
+  NodeProperties::SetType(t_length, type_cache_->kStringLengthType);
+  Node* const t =
+      graph()->NewNode(simplified()->StringConcat(), t_length, buf, piece);
+  NodeProperties::SetType(t, Type::String());
+
+  // Keep {t} in the buffer while it is flat, otherwise attach it to {acc}.
+  // The diamond goes right before the back edge.
+  Node* const check =
+      graph()->NewNode(simplified()->NumberLessThan(), t_length,
+                       jsgraph()->Constant(ConsString::kMinLength));
+  NodeProperties::SetType(check, Type::Boolean());
+  Node* const branch = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                        check, loop_node->InputAt(1));
+  Node* const if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* const if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* const merge = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  Node* const next_length = NodeProperties::GetValueInput(next, 0);
+  Node* const attached =
+      graph()->NewNode(simplified()->StringConcat(), next_length, acc, t);
+  NodeProperties::SetType(attached, Type::String());
+  Node* const acc_next =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2), acc,
+                       attached, merge);
+  NodeProperties::SetType(acc_next, Type::String());
+  Node* const buf_next = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), t, empty, merge);
+  NodeProperties::SetType(buf_next, Type::String());
+  loop_node->ReplaceInput(1, merge);
+  acc->ReplaceInput(1, acc_next);
+  buf->ReplaceInput(1, buf_next);
+
+  // Rewire the uses of s and s', neither of which is computed any more.
+  Node* const acc_length = graph()->NewNode(simplified()->StringLength(), acc);
+  NodeProperties::SetType(acc_length, type_cache_->kStringLengthType);
+  Node* const length =
+      graph()->NewNode(simplified()->NumberAdd(), acc_length, buf_length);
+  NodeProperties::SetType(length, type_cache_->kStringLengthType);
+  ReplaceUses(phi, next, length, acc, buf);
+  ReplaceUses(next, phi, next_length, acc, t);
+  phi->NullAllInputs();
+  next->Kill();
+  phi->Kill();
+}
+
+void StringAccumulation::ReplaceUses(Node* string, Node* skip, Node* length,
+                                     Node* first, Node* second) {
+  Node* state = nullptr;
+  Node* value = nullptr;
+  for (Edge edge : string->use_edges()) {
+    Node* const user = edge.from();
+    if (user == skip) continue;
+    if (user->opcode() == IrOpcode::kStringLength) {
+      user->ReplaceUses(length);
+      user->Kill();
+    } else if (IsDeoptimizationOnlyUse(edge)) {
+      if (state == nullptr) {
+        state = ConsStringState(jsgraph(), string, first, second);
+      }
+      edge.UpdateTo(state);
+    } else {
+      // Only uses after the loop get here.
+      if (value == nullptr) {
+        value = graph()->NewNode(simplified()->StringConcat(), length, first,
+                                 second);
+        NodeProperties::SetType(value, Type::String());
+      }
+      edge.UpdateTo(value);
+    }
+  }
+}
+
+CommonOperatorBuilder* StringAccumulation::common() const {
+  return jsgraph()->common();
+}
+
+Graph* StringAccumulation::graph() const { return jsgraph()->graph(); }
+
+SimplifiedOperatorBuilder* StringAccumulation::simplified() const {
+  return jsgraph()->simplified();
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
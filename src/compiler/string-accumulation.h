@@ -0,0 +1,68 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_STRING_ACCUMULATION_H_
+#define V8_COMPILER_STRING_ACCUMULATION_H_
+
+#include "src/common/globals.h"
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class CommonOperatorBuilder;
+class Edge;
+class Graph;
+class JSGraph;
+class SimplifiedOperatorBuilder;
+class TypeCache;
+
+// Rewrites strings that grow by one piece per loop iteration, i.e.
+//
+//   s  = Phi(s0, s')            at the loop header
+//   s' = StringConcat(s, x)     in the loop body
+//
+// into an accumulator {acc} and a short buffer {buf} with s = acc + buf. The
+// pieces are appended to {buf} while the result stays shorter than
+// ConsString::kMinLength, i.e. while it is a flat string, and only then is
+// {buf} attached to {acc}. So the rope gains one node per filled buffer
+// instead of one per piece. Frame states describe s to the deoptimizer as
+// the ConsString of its parts; s itself is only allocated for its uses
+// after the loop.
+class V8_EXPORT_PRIVATE StringAccumulation final {
+ public:
+  StringAccumulation(JSGraph* jsgraph, LoopTree* loop_tree, Zone* zone);
+
+  void Run();
+
+ private:
+  void VisitLoop(LoopTree::Loop* loop);
+  void TryAccumulate(LoopTree::Loop* loop, Node* loop_node, Node* phi);
+  bool IsReplaceableUse(LoopTree::Loop* loop, Edge edge);
+  void ReplaceUses(Node* string, Node* skip, Node* length, Node* first,
+                   Node* second);
+
+  CommonOperatorBuilder* common() const;
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() const;
+  Zone* zone() const { return zone_; }
+
+  JSGraph* const jsgraph_;
+  LoopTree* const loop_tree_;
+  // Nodes created by this pass are unknown to {loop_tree_}.
+  size_t const node_count_;
+  TypeCache const* type_cache_;
+  Zone* const zone_;
+
+  DISALLOW_COPY_AND_ASSIGN(StringAccumulation);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_STRING_ACCUMULATION_H_
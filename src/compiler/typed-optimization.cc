@@ -11,6 +11,7 @@
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/compiler/state-values-utils.h"
 #include "src/compiler/type-cache.h"
 #include "src/execution/isolate-inl.h"
 
@@ -72,6 +73,8 @@ Reduction TypedOptimization::Reduce(Node* node) {
     case IrOpcode::kStringLessThan:
     case IrOpcode::kStringLessThanOrEqual:
       return ReduceStringComparison(node);
+    case IrOpcode::kStringConcat:
+      return ReduceStringConcat(node);
     case IrOpcode::kStringLength:
       return ReduceStringLength(node);
     case IrOpcode::kSameValue:
@@ -497,6 +500,57 @@ Reduction TypedOptimization::ReduceStringComparison(Node* node) {
   return NoChange();
 }
 
+Reduction TypedOptimization::ReduceStringConcat(Node* node) {
+  DCHECK_EQ(IrOpcode::kStringConcat, node->opcode());
+  Node* const lhs = NodeProperties::GetValueInput(node, 1);
+  Node* const rhs = NodeProperties::GetValueInput(node, 2);
+  if (lhs->opcode() != IrOpcode::kStringConcat) return NoChange();
+
+  // Only reassociate if the intermediate string is not observable, i.e. it
+  // is only used by {node}, by StringLength nodes that fold to its length
+  // input anyway, and by frame states. Nodes without uses are dead.
+  bool has_frame_state_uses = false;
+  for (Edge const edge : lhs->use_edges()) {
+    Node* const use = edge.from();
+    if (use == node || use->opcode() == IrOpcode::kStringLength ||
+        use->UseCount() == 0) {
+      continue;
+    }
+    if (!IsDeoptimizationOnlyUse(edge)) return NoChange();
+    has_frame_state_uses = true;
+  }
+
+  // StringConcat(StringConcat(a, b), c) => StringConcat(a, StringConcat(b, c))
+  // This keeps chains like `s = s + a + b` from adding one rope node to the
+  // (usually long) accumulated string {a} per operand; the short strings are
+  // combined first, often into a flat string.
+  Node* const first = NodeProperties::GetValueInput(lhs, 1);
+  Node* const second = NodeProperties::GetValueInput(lhs, 2);
+  if (has_frame_state_uses) {
+    // The deoptimizer rebuilds the intermediate string from its parts, so
+    // it is only allocated when we actually deoptimize.
+    Node* const state = ConsStringState(jsgraph(), lhs, first, second);
+    for (Edge edge : lhs->use_edges()) {
+      if (IsDeoptimizationOnlyUse(edge)) edge.UpdateTo(state);
+    }
+  }
+  Node* second_length = graph()->NewNode(simplified()->StringLength(), second);
+  NodeProperties::SetType(second_length, type_cache_->kStringLengthType);
+  Node* rhs_length = graph()->NewNode(simplified()->StringLength(), rhs);
+  NodeProperties::SetType(rhs_length, type_cache_->kStringLengthType);
+  // The sum cannot exceed the {length} of {node}, which was already checked
+  // against String::kMaxLength.
+  Node* tail_length =
+      graph()->NewNode(simplified()->NumberAdd(), second_length, rhs_length);
+  NodeProperties::SetType(tail_length, type_cache_->kStringLengthType);
+  Node* tail = graph()->NewNode(simplified()->StringConcat(), tail_length,
+                                second, rhs);
+  NodeProperties::SetType(tail, Type::String());
+  NodeProperties::ReplaceValueInput(node, first, 1);
+  NodeProperties::ReplaceValueInput(node, tail, 2);
+  return Changed(node);
+}
+
 Reduction TypedOptimization::ReduceStringLength(Node* node) {
   DCHECK_EQ(IrOpcode::kStringLength, node->opcode());
   Node* const input = NodeProperties::GetValueInput(node, 0);
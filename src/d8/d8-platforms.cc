@@ -163,6 +163,11 @@ class DelayedTasksPlatform : public Platform {
                                          delay_in_seconds);
   }
 
+  std::unique_ptr<JobHandle> PostJob(
+      TaskPriority priority, std::unique_ptr<JobTask> job_task) override {
+    return platform_->PostJob(priority, std::move(job_task));
+  }
+
   void CallOnForegroundThread(v8::Isolate* isolate, Task* task) override {
     // This is a deprecated function and should not be called anymore.
     UNREACHABLE();
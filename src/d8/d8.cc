@@ -397,11 +397,13 @@ class DummySourceStream : public v8::ScriptCompiler::ExternalSourceStream {
                       source_length_);
   }
 
+  bool KeepsDataOwnership() override { return true; }
+
   size_t GetMoreData(const uint8_t** src) override {
     if (done_) {
       return 0;
     }
-    *src = source_buffer_.release();
+    *src = source_buffer_.get();
     done_ = true;
 
     return source_length_;
@@ -3442,6 +3442,7 @@ void TranslatedState::InitializeCapturedObjectAt(
   switch (map->instance_type()) {
     case MUTABLE_HEAP_NUMBER_TYPE:
     case FIXED_DOUBLE_ARRAY_TYPE:
+    case CONS_STRING_TYPE:
       return;
 
     case FIXED_ARRAY_TYPE:
@@ -3531,6 +3532,26 @@ void TranslatedState::MaterializeMutableHeapNumber(TranslatedFrame* frame,
   slot->set_storage(box);
 }
 
+void TranslatedState::MaterializeConsString(TranslatedFrame* frame,
+                                            int* value_index,
+                                            TranslatedValue* slot) {
+  Handle<String> parts[2];
+  for (Handle<String>& part : parts) {
+    CHECK_NE(TranslatedValue::kCapturedObject,
+             frame->values_[*value_index].kind());
+    Handle<Object> value = frame->values_[*value_index].GetValue();
+    CHECK(value->IsString());
+    part = Handle<String>::cast(value);
+    (*value_index)++;
+  }
+  // The optimized code already checked the length of the result. Like the
+  // StringConcat that it skipped, this yields a flat string for short results
+  // and one of the parts if the other one is empty.
+  Handle<String> string =
+      isolate()->factory()->NewConsString(parts[0], parts[1]).ToHandleChecked();
+  slot->set_storage(string);
+}
+
 namespace {
 
 enum DoubleStorageKind : uint8_t {
@@ -3587,6 +3608,11 @@ void TranslatedState::EnsureCapturedObjectAllocatedAt(
       // There is no need to process the children.
       return MaterializeMutableHeapNumber(frame, &value_index, slot);
 
+    case CONS_STRING_TYPE:
+      // Materialize the string {first} + {second} and return. There is no
+      // need to process the children.
+      return MaterializeConsString(frame, &value_index, slot);
+
     case FIXED_ARRAY_TYPE:
     case SCRIPT_CONTEXT_TABLE_TYPE:
     case AWAIT_CONTEXT_TYPE:
@@ -353,6 +353,8 @@ class TranslatedState {
                                    TranslatedValue* slot, Handle<Map> map);
   void MaterializeMutableHeapNumber(TranslatedFrame* frame, int* value_index,
                                     TranslatedValue* slot);
+  void MaterializeConsString(TranslatedFrame* frame, int* value_index,
+                             TranslatedValue* slot);
 
   void EnsureObjectAllocatedAt(TranslatedValue* slot);
 
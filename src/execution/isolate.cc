@@ -66,6 +66,7 @@
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
 #include "src/regexp/regexp-stack.h"
+#include "src/snapshot/cached-feedback.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/embedded/embedded-file-writer.h"
 #include "src/snapshot/read-only-deserializer.h"
@@ -3657,6 +3658,16 @@ CompilationStatistics* Isolate::GetTurboStatistics() {
   return turbo_statistics();
 }
 
+CachedFeedback* Isolate::EnsureCachedFeedback() {
+  if (!cached_feedback_) cached_feedback_.reset(new CachedFeedback());
+  return cached_feedback_.get();
+}
+
+void Isolate::ApplyCachedFeedback(FeedbackVector vector) {
+  DCHECK_NOT_NULL(cached_feedback_);
+  cached_feedback_->Apply(vector);
+}
+
 CodeTracer* Isolate::GetCodeTracer() {
   if (code_tracer() == nullptr) set_code_tracer(new CodeTracer(id()));
   return code_tracer();
@@ -64,6 +64,7 @@ class AddressToIndexHashMap;
 class AstStringConstants;
 class Bootstrapper;
 class BuiltinsConstantsTableBuilder;
+class CachedFeedback;
 class CancelableTaskManager;
 class CodeEventDispatcher;
 class CodeTracer;
@@ -77,6 +78,7 @@ class DeoptimizerData;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
+class FeedbackVector;
 class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
@@ -893,8 +895,21 @@ class Isolate final : private HiddenFactory {
     DCHECK_NOT_NULL(async_counters_.get());
     return async_counters_;
   }
+  const std::shared_ptr<v8::metrics::Recorder>& metrics_recorder() {
+    return metrics_recorder_;
+  }
+  void set_metrics_recorder(
+      const std::shared_ptr<v8::metrics::Recorder>& metrics_recorder) {
+    metrics_recorder_ = metrics_recorder;
+  }
   RuntimeProfiler* runtime_profiler() { return runtime_profiler_; }
   CompilationCache* compilation_cache() { return compilation_cache_; }
+  // Feedback recorded in consumed code caches, or nullptr if there is none.
+  CachedFeedback* cached_feedback() { return cached_feedback_.get(); }
+  CachedFeedback* EnsureCachedFeedback();
+  // Seeds a newly allocated feedback vector with the feedback recorded for its
+  // function in a consumed code cache. Only call if cached_feedback() is set.
+  void ApplyCachedFeedback(FeedbackVector vector);
   Logger* logger() {
     // Call InitializeLoggingAndCounters() if logging is needed before
     // the isolate is fully initialized.
@@ -1072,6 +1087,19 @@ class Isolate final : private HiddenFactory {
     return snapshot_blob_ != nullptr && snapshot_blob_->raw_size != 0;
   }
 
+  // Context snapshots are checksummed separately and verified when they are
+  // first deserialized in this isolate.
+  bool context_snapshot_verified(size_t index) const {
+    return index < verified_context_snapshots_.size() &&
+           verified_context_snapshots_[index];
+  }
+  void set_context_snapshot_verified(size_t index) {
+    if (index >= verified_context_snapshots_.size()) {
+      verified_context_snapshots_.resize(index + 1);
+    }
+    verified_context_snapshots_[index] = true;
+  }
+
   bool IsDead() { return has_fatal_error_; }
   void SignalFatalError() { has_fatal_error_ = true; }
 
@@ -1662,7 +1690,9 @@ class Isolate final : private HiddenFactory {
   Bootstrapper* bootstrapper_ = nullptr;
   RuntimeProfiler* runtime_profiler_ = nullptr;
   CompilationCache* compilation_cache_ = nullptr;
+  std::unique_ptr<CachedFeedback> cached_feedback_;
   std::shared_ptr<Counters> async_counters_;
+  std::shared_ptr<v8::metrics::Recorder> metrics_recorder_;
   base::RecursiveMutex break_access_;
   Logger* logger_ = nullptr;
   StackGuard stack_guard_;
@@ -1732,6 +1762,9 @@ class Isolate final : private HiddenFactory {
   // True if this isolate was initialized from a snapshot.
   bool initialized_from_snapshot_ = false;
 
+  // Indices of the context snapshots whose checksum has been verified.
+  std::vector<bool> verified_context_snapshots_;
+
   // TODO(ishell): remove
   // True if ES2015 tail call elimination feature is enabled.
   bool is_tail_call_elimination_enabled_ = true;
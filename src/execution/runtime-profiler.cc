@@ -4,6 +4,8 @@
 
 #include "src/execution/runtime-profiler.h"
 
+#include <algorithm>
+
 #include "src/base/platform/platform.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/compilation-cache.h"
@@ -18,24 +20,11 @@
 namespace v8 {
 namespace internal {
 
-// Number of times a function has to be seen on the stack before it is
-// optimized.
-static const int kProfilerTicksBeforeOptimization = 2;
-
-// The number of ticks required for optimizing a function increases with
-// the size of the bytecode. This is in addition to the
-// kProfilerTicksBeforeOptimization required for any function.
-static const int kBytecodeSizeAllowancePerTick = 1200;
-
 // Maximum size in bytes of generate code for a function to allow OSR.
 static const int kOSRBytecodeSizeAllowanceBase = 180;
 
 static const int kOSRBytecodeSizeAllowancePerTick = 48;
 
-// Maximum size in bytes of generated code for a function to be optimized
-// the very first time it is seen on the stack.
-static const int kMaxBytecodeSizeForEarlyOpt = 90;
-
 #define OPTIMIZATION_REASON_LIST(V)   \
   V(DoNotOptimize, "do not optimize") \
   V(HotAndStable, "hot and stable")   \
@@ -158,16 +147,22 @@ bool RuntimeProfiler::MaybeOSR(JSFunction function, InterpretedFrame* frame) {
   return false;
 }
 
+// static
+int RuntimeProfiler::TicksForOptimization(BytecodeArray bytecode) {
+  // The allowance is a flag, so guard against it being set to zero.
+  int allowance_per_tick = std::max(1, FLAG_bytecode_size_allowance_per_tick);
+  return FLAG_ticks_before_optimization +
+         (bytecode.length() / allowance_per_tick);
+}
+
 OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
                                                    BytecodeArray bytecode) {
   int ticks = function.feedback_vector().profiler_ticks();
-  int ticks_for_optimization =
-      kProfilerTicksBeforeOptimization +
-      (bytecode.length() / kBytecodeSizeAllowancePerTick);
+  int ticks_for_optimization = TicksForOptimization(bytecode);
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
   } else if (!any_ic_changed_ &&
-             bytecode.length() < kMaxBytecodeSizeForEarlyOpt) {
+             bytecode.length() < FLAG_max_bytecode_size_for_early_opt) {
     // If no IC was patched since the last tick and this function is very
     // small, optimistically optimize it now.
     return OptimizationReason::kSmallFunction;
@@ -175,12 +170,12 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
     PrintF("[not yet optimizing ");
     function.PrintName();
     PrintF(", not enough ticks: %d/%d and ", ticks,
-           kProfilerTicksBeforeOptimization);
+           ticks_for_optimization);
     if (any_ic_changed_) {
       PrintF("ICs changed]\n");
     } else {
       PrintF(" too large for small function optimization: %d/%d]\n",
-             bytecode.length(), kMaxBytecodeSizeForEarlyOpt);
+             bytecode.length(), FLAG_max_bytecode_size_for_early_opt);
     }
   }
   return OptimizationReason::kDoNotOptimize;
@@ -27,6 +27,10 @@ class RuntimeProfiler {
   void AttemptOnStackReplacement(InterpretedFrame* frame,
                                  int nesting_levels = 1);
 
+  // Number of profiler ticks after which a function with |bytecode| is
+  // considered hot enough for optimization.
+  static int TicksForOptimization(BytecodeArray bytecode);
+
  private:
   void MaybeOptimize(JSFunction function, InterpretedFrame* frame);
   // Potentially attempts OSR from and returns whether no other
@@ -368,6 +368,17 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 DEFINE_INT(interrupt_budget, 144 * KB,
            "interrupt budget which should be used for the profiler counter")
 
+// Flags for tiering up from the interpreter to TurboFan.
+DEFINE_INT(ticks_before_optimization, 2,
+           "the number of times we have to go through the interrupt budget "
+           "before considering this function for optimization")
+DEFINE_INT(bytecode_size_allowance_per_tick, 1200,
+           "increases the number of ticks required for optimization by "
+           "bytecode.length/X")
+DEFINE_INT(max_bytecode_size_for_early_opt, 90,
+           "Maximum bytecode length for a function to be optimized on the "
+           "first tick")
+
 // Flags for jitless
 DEFINE_BOOL(jitless, V8_LITE_BOOL,
             "Disable runtime allocation of executable memory.")
@@ -467,6 +478,11 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_control_flow_aware_allocation, false,
             "consider control flow while allocating registers")
+DEFINE_UINT(turbo_fast_register_allocation_threshold, 50000,
+            "use the fast register allocation pipeline for code with more "
+            "instructions than this (0 means never)")
+DEFINE_BOOL(turbo_fast_register_allocation, false,
+            "always use the fast register allocation pipeline")
 
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
@@ -562,6 +578,8 @@ DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
+DEFINE_BOOL(turbo_string_accumulation, true,
+            "Turbofan buffering of strings built up in loops")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
@@ -1183,10 +1201,16 @@ DEFINE_BOOL_READONLY(embedded_builtins, V8_EMBEDDED_BUILTINS_BOOL,
                      "Embed builtin code into the binary.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(verify_snapshot_checksum, true,
+            "Verify snapshot checksums when deserializing snapshots. Each "
+            "context snapshot is only verified when it is deserialized.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 DEFINE_UINT(serialization_chunk_size, 4096,
             "Custom size for serialization chunks")
+DEFINE_BOOL(cache_feedback, false,
+            "Record type feedback of optimized functions in the code cache "
+            "and use it to warm up these functions after deserialization.")
 
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
@@ -21,21 +21,23 @@ LocalArrayBufferTracker::~LocalArrayBufferTracker() {
 template <typename Callback>
 void LocalArrayBufferTracker::Process(Callback callback) {
   std::vector<JSArrayBuffer::Allocation> backing_stores_to_free;
-  TrackingData kept_array_buffers;
 
   JSArrayBuffer new_buffer;
   JSArrayBuffer old_buffer;
   size_t freed_memory = 0;
+  // Entries are erased in place rather than copying the kept ones into a
+  // fresh map, which avoids rehashing on every processed page.
   for (TrackingData::iterator it = array_buffers_.begin();
-       it != array_buffers_.end(); ++it) {
+       it != array_buffers_.end();) {
     old_buffer = it->first;
     DCHECK_EQ(page_, Page::FromHeapObject(old_buffer));
     const CallbackResult result = callback(old_buffer, &new_buffer);
     if (result == kKeepEntry) {
-      kept_array_buffers.insert(*it);
+      ++it;
     } else if (result == kUpdateEntry) {
       DCHECK(!new_buffer.is_null());
       Page* target_page = Page::FromHeapObject(new_buffer);
+      DCHECK_NE(page_, target_page);
       {
         base::MutexGuard guard(target_page->mutex());
         LocalArrayBufferTracker* tracker = target_page->local_tracker();
@@ -54,12 +56,14 @@ void LocalArrayBufferTracker::Process(Callback callback) {
             static_cast<MemoryChunk*>(page_),
             static_cast<MemoryChunk*>(target_page), length);
       }
+      it = array_buffers_.erase(it);
     } else if (result == kRemoveEntry) {
       freed_memory += it->second.length;
       // We pass backing_store() and stored length to the collector for freeing
       // the backing store. Wasm allocations will go through their own tracker
       // based on the backing store.
       backing_stores_to_free.push_back(it->second);
+      it = array_buffers_.erase(it);
     } else {
       UNREACHABLE();
     }
@@ -72,12 +76,12 @@ void LocalArrayBufferTracker::Process(Callback callback) {
         static_cast<intptr_t>(freed_memory));
   }
 
-  array_buffers_.swap(kept_array_buffers);
-
   // Pass the backing stores that need to be freed to the main thread for
   // potential later distribution.
-  page_->heap()->array_buffer_collector()->QueueOrFreeGarbageAllocations(
-      std::move(backing_stores_to_free));
+  if (!backing_stores_to_free.empty()) {
+    page_->heap()->array_buffer_collector()->QueueOrFreeGarbageAllocations(
+        std::move(backing_stores_to_free));
+  }
 }
 
 void ArrayBufferTracker::PrepareToFreeDeadInNewSpace(Heap* heap) {
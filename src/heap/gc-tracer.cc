@@ -6,6 +6,7 @@
 
 #include <cstdarg>
 
+#include "include/v8-metrics.h"
 #include "src/base/atomic-utils.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
@@ -357,6 +358,8 @@ void GCTracer::Stop(GarbageCollector collector) {
 
   heap_->UpdateTotalGCTime(duration);
 
+  if (heap_->isolate()->metrics_recorder()) ReportGarbageCollectionCycle();
+
   if ((current_.type == Event::SCAVENGER ||
        current_.type == Event::MINOR_MARK_COMPACTOR) &&
       FLAG_trace_gc_ignore_scavenger)
@@ -391,6 +394,61 @@ void GCTracer::NotifySweepingCompleted() {
   }
 }
 
+void GCTracer::ReportGarbageCollectionCycle() {
+  v8::metrics::GarbageCollectionCycle event;
+  switch (current_.type) {
+    case Event::SCAVENGER:
+      event.type = v8::metrics::GarbageCollectionCycle::Type::kScavenge;
+      break;
+    case Event::MINOR_MARK_COMPACTOR:
+      event.type = v8::metrics::GarbageCollectionCycle::Type::kMinorMarkCompact;
+      break;
+    case Event::MARK_COMPACTOR:
+      event.type = v8::metrics::GarbageCollectionCycle::Type::kMarkCompact;
+      break;
+    case Event::INCREMENTAL_MARK_COMPACTOR:
+      event.type =
+          v8::metrics::GarbageCollectionCycle::Type::kIncrementalMarkCompact;
+      break;
+    case Event::START:
+      UNREACHABLE();
+  }
+  event.reason = Heap::GarbageCollectionReasonToString(current_.gc_reason);
+  event.reduce_memory = current_.reduce_memory;
+  event.start_time_in_ms = current_.start_time;
+  event.end_time_in_ms = current_.end_time;
+  event.incremental_marking_duration_in_ms =
+      current_.incremental_marking_duration;
+  event.incremental_marking_steps =
+      current_.incremental_marking_scopes[Scope::MC_INCREMENTAL -
+                                          Scope::FIRST_INCREMENTAL_SCOPE]
+          .steps;
+  event.start_object_size_in_bytes = current_.start_object_size;
+  event.end_object_size_in_bytes = current_.end_object_size;
+  event.start_memory_size_in_bytes = current_.start_memory_size;
+  event.end_memory_size_in_bytes = current_.end_memory_size;
+  event.survived_young_object_size_in_bytes =
+      current_.survived_young_object_size;
+  event.promoted_object_size_in_bytes = heap_->promoted_objects_size();
+
+  v8::metrics::GarbageCollectionPhase phases[Scope::NUMBER_OF_SCOPES];
+  size_t phase_count = 0;
+  double background_duration = 0;
+  for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
+    if (current_.scopes[i] == 0) continue;
+    Scope::ScopeId id = static_cast<Scope::ScopeId>(i);
+    phases[phase_count++] = {Scope::Name(id), current_.scopes[i]};
+    if (id >= Scope::FIRST_GENERAL_BACKGROUND_SCOPE) {
+      background_duration += current_.scopes[i];
+    }
+  }
+  event.background_duration_in_ms = background_duration;
+  event.phases = phases;
+  event.phase_count = phase_count;
+
+  heap_->isolate()->metrics_recorder()->AddMainThreadEvent(event);
+}
+
 void GCTracer::SampleAllocation(double current_ms,
                                 size_t new_space_counter_bytes,
                                 size_t old_generation_counter_bytes,
@@ -1112,9 +1170,18 @@ void GCTracer::FetchBackgroundMinorGCCounters() {
                           Scope::LAST_MINOR_GC_BACKGROUND_SCOPE,
                           BackgroundScope::FIRST_MINOR_GC_BACKGROUND_SCOPE,
                           BackgroundScope::LAST_MINOR_GC_BACKGROUND_SCOPE);
-  heap_->isolate()->counters()->background_scavenger()->AddSample(
-      static_cast<int>(
-          current_.scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL]));
+  if (current_.type == Event::MINOR_MARK_COMPACTOR) {
+    heap_->isolate()->counters()->background_minor_mc()->AddSample(
+        static_cast<int>(
+            current_.scopes[Scope::MINOR_MC_BACKGROUND_MARKING] +
+            current_.scopes[Scope::MINOR_MC_BACKGROUND_EVACUATE_COPY] +
+            current_.scopes
+                [Scope::MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS]));
+  } else {
+    heap_->isolate()->counters()->background_scavenger()->AddSample(
+        static_cast<int>(
+            current_.scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL]));
+  }
 }
 
 void GCTracer::FetchBackgroundGeneralCounters() {
@@ -1217,6 +1284,15 @@ void GCTracer::RecordGCPhasesHistograms(TimedHistogram* gc_timer) {
         static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL]));
     counters->gc_scavenger_scavenge_roots()->AddSample(
         static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_ROOTS]));
+  } else if (gc_timer == counters->gc_minor_mark_compactor()) {
+    counters->gc_minor_mc_mark()->AddSample(
+        static_cast<int>(current_.scopes[Scope::MINOR_MC_MARK]));
+    counters->gc_minor_mc_clear()->AddSample(
+        static_cast<int>(current_.scopes[Scope::MINOR_MC_CLEAR]));
+    counters->gc_minor_mc_evacuate()->AddSample(
+        static_cast<int>(current_.scopes[Scope::MINOR_MC_EVACUATE]));
+    counters->gc_minor_mc_update_pointers()->AddSample(static_cast<int>(
+        current_.scopes[Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS]));
   }
 }
 
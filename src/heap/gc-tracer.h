@@ -390,6 +390,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   // recording takes place at the end of the atomic pause.
   void RecordGCSumCounters(double atomic_pause_duration);
 
+  // Hands the current event to the embedder's metrics recorder.
+  void ReportGarbageCollectionCycle();
+
   // Print one detailed trace line in name=value format.
   // TODO(ernstm): Move to Heap.
   void PrintNVP() const;
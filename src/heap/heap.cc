@@ -1286,7 +1286,9 @@ TimedHistogram* Heap::GCTypePriorityTimer(GarbageCollector collector) {
 }
 
 TimedHistogram* Heap::GCTypeTimer(GarbageCollector collector) {
-  if (IsYoungGenerationCollector(collector)) {
+  if (collector == MINOR_MARK_COMPACTOR) {
+    return isolate_->counters()->gc_minor_mark_compactor();
+  } else if (IsYoungGenerationCollector(collector)) {
     return isolate_->counters()->gc_scavenger();
   } else {
     if (!incremental_marking()->IsStopped()) {
@@ -1569,9 +1571,7 @@ bool Heap::CollectGarbage(AllocationSpace space,
 
       next_gc_likely_to_collect_more =
           PerformGarbageCollection(collector, gc_callback_flags);
-      if (collector == MARK_COMPACTOR || collector == SCAVENGER) {
-        tracer()->RecordGCPhasesHistograms(gc_type_timer);
-      }
+      tracer()->RecordGCPhasesHistograms(gc_type_timer);
     }
 
     // Clear is_current_gc_forced now that the current GC is complete. Do this
@@ -3737,6 +3737,45 @@ void Heap::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   UNREACHABLE();
 }
 
+void Heap::SetMaxOldGenerationSize(size_t max_old_generation_size) {
+  // Do not set the limit lower than the live size + some slack.
+  size_t min_limit = Max(SizeOfObjects() + SizeOfObjects() / 4,
+                         MinOldGenerationSize());
+  size_t old_max_old_generation_size = max_old_generation_size_;
+  max_old_generation_size_ = RoundDown<Page::kPageSize>(
+      Max(max_old_generation_size, RoundUp<Page::kPageSize>(min_limit)));
+  // The new limit becomes the baseline for near-heap-limit callbacks and for
+  // automatically restoring the initial heap limit.
+  initial_max_old_generation_size_ = max_old_generation_size_;
+
+  // A larger limit takes effect with the next limit recomputation, which
+  // derives the growing factor from the new maximum.
+  size_t old_gen_size = OldGenerationSizeOfObjects();
+  if (max_old_generation_size_ >= old_max_old_generation_size ||
+      old_gen_size == 0) {
+    return;
+  }
+  // A smaller limit immediately pulls in the allocation limit, so that the
+  // next marking cycle starts ahead of the new maximum.
+  double v8_gc_speed =
+      tracer()->CombinedMarkCompactSpeedInBytesPerMillisecond();
+  double v8_mutator_speed =
+      tracer()->CurrentOldGenerationAllocationThroughputInBytesPerMillisecond();
+  double v8_growing_factor = MemoryController<V8HeapTrait>::GrowingFactor(
+      this, max_old_generation_size_, v8_gc_speed, v8_mutator_speed);
+  size_t new_old_generation_limit =
+      MemoryController<V8HeapTrait>::CalculateAllocationLimit(
+          this, old_gen_size, min_old_generation_size_,
+          max_old_generation_size_, new_space()->Capacity(), v8_growing_factor,
+          CurrentHeapGrowingMode());
+  if (new_old_generation_limit < old_generation_allocation_limit_) {
+    old_generation_allocation_limit_ = new_old_generation_limit;
+    StartIncrementalMarkingIfAllocationLimitIsReached(
+        GCFlagsForIncrementalMarking(),
+        kGCCallbackScheduleIdleGarbageCollection);
+  }
+}
+
 void Heap::AutomaticallyRestoreInitialHeapLimit(double threshold_percent) {
   initial_max_old_generation_size_threshold_ =
       initial_max_old_generation_size_ * threshold_percent;
@@ -620,6 +620,13 @@ class Heap {
     return memory_pressure_level_ != MemoryPressureLevel::kNone;
   }
 
+  // Changes the maximum old generation size at runtime. The limit is clamped so
+  // that it does not fall below the live size plus some slack. Lowering the
+  // limit also lowers the allocation limit, so that incremental marking starts
+  // well ahead of the new limit.
+  V8_EXPORT_PRIVATE void SetMaxOldGenerationSize(
+      size_t max_old_generation_size);
+
   void RestoreHeapLimit(size_t heap_limit) {
     // Do not set the limit lower than the live size + some slack.
     size_t min_limit = SizeOfObjects() + SizeOfObjects() / 4;
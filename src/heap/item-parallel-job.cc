@@ -4,7 +4,9 @@
 
 #include "src/heap/item-parallel-job.h"
 
+#include "include/v8-platform.h"
 #include "src/base/platform/semaphore.h"
+#include "src/base/template-utils.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 
@@ -31,6 +33,40 @@ void ItemParallelJob::Task::RunInternal() {
   on_finish_->Signal();
 }
 
+namespace {
+
+// Runs the background tasks of an ItemParallelJob as a single platform job.
+// Each call to Run() picks the next task that has not been started yet, so
+// every task still runs exactly once.
+class BackgroundTasksJob final : public JobTask {
+ public:
+  explicit BackgroundTasksJob(std::vector<ItemParallelJob::Task*> tasks)
+      : tasks_(std::move(tasks)), remaining_tasks_(tasks_.size()) {}
+
+  void Run(JobDelegate* delegate) override {
+    const size_t index = next_task_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= tasks_.size()) return;
+    tasks_[index]->Run();
+    remaining_tasks_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Tasks that are running still count, so that finished workers give up
+  // their slot instead of polling for more work.
+  size_t GetMaxConcurrency() const override {
+    return remaining_tasks_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Owned by the ItemParallelJob, which outlives the Join() of this job.
+  std::vector<ItemParallelJob::Task*> tasks_;
+  std::atomic<size_t> next_task_{0};
+  std::atomic<size_t> remaining_tasks_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundTasksJob);
+};
+
+}  // namespace
+
 ItemParallelJob::ItemParallelJob(CancelableTaskManager* cancelable_task_manager,
                                  base::Semaphore* pending_tasks)
     : cancelable_task_manager_(cancelable_task_manager),
@@ -73,10 +109,9 @@ void ItemParallelJob::Run() {
                                     : 0;
   CancelableTaskManager::Id* task_ids =
       new CancelableTaskManager::Id[num_tasks];
-  std::unique_ptr<Task> main_task;
   for (size_t i = 0, start_index = 0; i < num_tasks;
        i++, start_index += items_per_task + (i < items_remainder ? 1 : 0)) {
-    auto task = std::move(tasks_[i]);
+    Task* task = tasks_[i].get();
     DCHECK(task);
 
     // By definition there are less |items_remainder| to distribute then
@@ -86,16 +121,31 @@ void ItemParallelJob::Run() {
 
     task->SetupInternal(pending_tasks_, &items_, start_index);
     task_ids[i] = task->id();
-    if (i > 0) {
-      V8::GetCurrentPlatform()->CallBlockingTaskOnWorkerThread(std::move(task));
-    } else {
-      main_task = std::move(task);
+  }
+
+  // Prefer a single job for the background tasks, which lets the platform
+  // pick the number of workers, over posting one worker task per task.
+  v8::Platform* platform = V8::GetCurrentPlatform();
+  std::unique_ptr<JobHandle> job_handle;
+  if (num_tasks > 1) {
+    std::vector<Task*> background_tasks;
+    for (size_t i = 1; i < num_tasks; i++) {
+      background_tasks.push_back(tasks_[i].get());
+    }
+    job_handle = platform->PostJob(
+        TaskPriority::kUserBlocking,
+        base::make_unique<BackgroundTasksJob>(std::move(background_tasks)));
+    if (!job_handle) {
+      for (size_t i = 1; i < num_tasks; i++) {
+        platform->CallBlockingTaskOnWorkerThread(std::move(tasks_[i]));
+      }
     }
   }
 
   // Contribute on main thread.
-  DCHECK(main_task);
-  main_task->Run();
+  tasks_[0]->Run();
+  // Then help with the background tasks that did not get a worker yet.
+  if (job_handle) job_handle->Join();
 
   // Wait for background tasks.
   for (size_t i = 0; i < num_tasks; i++) {
@@ -27,7 +27,9 @@ class Isolate;
 
 // This class manages background tasks that process a set of items in parallel.
 // The first task added is executed on the same thread as |job.Run()| is called.
-// All other tasks are scheduled in the background.
+// All other tasks are scheduled in the background, as one job if the platform
+// supports Platform::PostJob(). The calling thread then also runs tasks that
+// have not been picked up by a worker yet.
 //
 // - Items need to inherit from ItemParallelJob::Item.
 // - Tasks need to inherit from ItemParallelJob::Task.
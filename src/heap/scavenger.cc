@@ -5,6 +5,7 @@
 #include "src/heap/scavenger.h"
 
 #include "src/heap/array-buffer-collector.h"
+#include "src/heap/array-buffer-tracker.h"
 #include "src/heap/barrier.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
@@ -73,6 +74,41 @@ class ScavengingTask final : public ItemParallelJob::Task {
   OneshotBarrier* const barrier_;
 };
 
+// Processes the array buffers tracked on a from-space page: buffers that were
+// evacuated are moved to the tracker of their target page, dead ones are
+// handed to the ArrayBufferCollector. Target trackers are updated under the
+// target page lock.
+class ArrayBufferProcessingItem final : public ItemParallelJob::Item {
+ public:
+  explicit ArrayBufferProcessingItem(Page* page) : page_(page) {}
+  ~ArrayBufferProcessingItem() override = default;
+
+  void Process() {
+    bool empty = ArrayBufferTracker::ProcessBuffers(
+        page_, ArrayBufferTracker::kUpdateForwardedRemoveOthers);
+    CHECK(empty);
+  }
+
+ private:
+  Page* const page_;
+};
+
+class ArrayBufferProcessingTask final : public ItemParallelJob::Task {
+ public:
+  explicit ArrayBufferProcessingTask(Isolate* isolate)
+      : ItemParallelJob::Task(isolate) {}
+
+  void RunInParallel() final {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                 "ArrayBufferProcessingTask::RunInParallel");
+    ArrayBufferProcessingItem* item = nullptr;
+    while ((item = GetItem<ArrayBufferProcessingItem>()) != nullptr) {
+      item->Process();
+      item->MarkFinished();
+    }
+  }
+};
+
 class IterateAndScavengePromotedObjectsVisitor final : public ObjectVisitor {
  public:
   IterateAndScavengePromotedObjectsVisitor(Scavenger* scavenger,
@@ -316,7 +352,7 @@ void ScavengerCollector::CollectGarbage() {
 
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_PROCESS_ARRAY_BUFFERS);
-    ArrayBufferTracker::PrepareToFreeDeadInNewSpace(heap_);
+    ProcessArrayBuffers();
   }
   heap_->array_buffer_collector()->FreeAllocations();
 
@@ -360,6 +396,28 @@ void ScavengerCollector::MergeSurvivingNewLargeObjects(
   }
 }
 
+void ScavengerCollector::ProcessArrayBuffers() {
+  if (!FLAG_parallel_scavenge) {
+    ArrayBufferTracker::PrepareToFreeDeadInNewSpace(heap_);
+    return;
+  }
+  ItemParallelJob job(isolate_->cancelable_task_manager(),
+                      &parallel_scavenge_semaphore_);
+  int pages = 0;
+  for (Page* page :
+       PageRange(heap_->new_space()->from_space().first_page(), nullptr)) {
+    if (!page->contains_array_buffers()) continue;
+    job.AddItem(new ArrayBufferProcessingItem(page));
+    pages++;
+  }
+  if (pages == 0) return;
+  const int num_tasks = Min(pages, NumberOfScavengeTasks());
+  for (int i = 0; i < num_tasks; i++) {
+    job.AddTask(new ArrayBufferProcessingTask(isolate_));
+  }
+  job.Run();
+}
+
 int ScavengerCollector::NumberOfScavengeTasks() {
   if (!FLAG_parallel_scavenge) return 1;
   const int num_scavenge_tasks =
@@ -50,6 +50,7 @@ class ScavengerCollector {
   void ClearYoungEphemerons(EphemeronTableList* ephemeron_table_list);
   void ClearOldEphemerons();
   void HandleSurvivingNewLargeObjects();
+  void ProcessArrayBuffers();
 
   Isolate* const isolate_;
   Heap* const heap_;
@@ -269,18 +269,41 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaTheHole:
       case Bytecode::kLdaConstant:
       case Bytecode::kLdaUndefined:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaGlobal:
       case Bytecode::kLdaNamedProperty:
+      case Bytecode::kLdaNamedPropertyNoFeedback:
       case Bytecode::kLdaKeyedProperty:
       case Bytecode::kLdaContextSlot:
+      case Bytecode::kLdaImmutableContextSlot:
       case Bytecode::kLdaCurrentContextSlot:
+      case Bytecode::kLdaImmutableCurrentContextSlot:
+      case Bytecode::kLdaModuleVariable:
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseXor:
+      case Bytecode::kBitwiseAnd:
+      case Bytecode::kShiftLeft:
+      case Bytecode::kShiftRight:
+      case Bytecode::kShiftRightLogical:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kMulSmi:
+      case Bytecode::kBitwiseOrSmi:
+      case Bytecode::kBitwiseAndSmi:
+      case Bytecode::kShiftLeftSmi:
+      case Bytecode::kShiftRightSmi:
+      case Bytecode::kShiftRightLogicalSmi:
       case Bytecode::kInc:
       case Bytecode::kDec:
+      case Bytecode::kNegate:
+      case Bytecode::kBitwiseNot:
+      case Bytecode::kToNumeric:
       case Bytecode::kTypeOf:
       case Bytecode::kCallAnyReceiver:
       case Bytecode::kCallNoFeedback:
@@ -292,8 +315,16 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kCallUndefinedReceiver0:
       case Bytecode::kCallUndefinedReceiver1:
       case Bytecode::kCallUndefinedReceiver2:
+      case Bytecode::kCallRuntime:
+      case Bytecode::kInvokeIntrinsic:
       case Bytecode::kConstruct:
       case Bytecode::kConstructWithSpread:
+      case Bytecode::kCreateClosure:
+      case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateObjectLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
+      case Bytecode::kGetTemplateObject:
         return true;
       default:
         return false;
@@ -29,6 +29,11 @@ namespace internal {
   HR(gc_finalize_sweep, V8.GCFinalizeMC.Sweep, 0, 10000, 101)                  \
   HR(gc_scavenger_scavenge_main, V8.GCScavenger.ScavengeMain, 0, 10000, 101)   \
   HR(gc_scavenger_scavenge_roots, V8.GCScavenger.ScavengeRoots, 0, 10000, 101) \
+  HR(gc_minor_mc_mark, V8.GCMinorMC.Mark, 0, 10000, 101)                       \
+  HR(gc_minor_mc_clear, V8.GCMinorMC.Clear, 0, 10000, 101)                     \
+  HR(gc_minor_mc_evacuate, V8.GCMinorMC.Evacuate, 0, 10000, 101)               \
+  HR(gc_minor_mc_update_pointers, V8.GCMinorMC.UpdatePointers, 0, 10000, 101)  \
+  HR(background_minor_mc, V8.GCBackgroundMinorMC, 0, 10000, 101)               \
   HR(gc_mark_compactor, V8.GCMarkCompactor, 0, 10000, 101)                     \
   HR(gc_marking_sum, V8.GCMarkingSum, 0, 10000, 101)                           \
   /* Range and bucket matches BlinkGC.MainThreadMarkingThroughput. */          \
@@ -36,6 +41,8 @@ namespace internal {
      100000, 50)                                                               \
   HR(scavenge_reason, V8.GCScavengeReason, 0, 22, 23)                          \
   HR(young_generation_handling, V8.GCYoungGenerationHandling, 0, 2, 3)         \
+  HR(turbofan_optimize_concurrent_queue_length,                                \
+     V8.TurboFanOptimizeConcurrentQueueLength, 0, 100, 101)                    \
   /* Asm/Wasm. */                                                              \
   HR(wasm_functions_per_asm_module, V8.WasmFunctionsPerModule.asm, 1, 1000000, \
      51)                                                                       \
@@ -143,6 +150,7 @@ namespace internal {
   HT(gc_scavenger, V8.GCScavenger, 10000, MILLISECOND)                         \
   HT(gc_scavenger_background, V8.GCScavengerBackground, 10000, MILLISECOND)    \
   HT(gc_scavenger_foreground, V8.GCScavengerForeground, 10000, MILLISECOND)    \
+  HT(gc_minor_mark_compactor, V8.GCMinorMC, 10000, MILLISECOND)                \
   /* TurboFan timers. */                                                       \
   HT(turbofan_optimize_prepare, V8.TurboFanOptimizePrepare, 1000000,           \
      MICROSECOND)                                                              \
@@ -160,6 +168,8 @@ namespace internal {
      V8.TurboFanOptimizeNonConcurrentTotalTime, 10000000, MICROSECOND)         \
   HT(turbofan_optimize_concurrent_total_time,                                  \
      V8.TurboFanOptimizeConcurrentTotalTime, 10000000, MICROSECOND)            \
+  HT(turbofan_optimize_concurrent_queue_wait,                                  \
+     V8.TurboFanOptimizeConcurrentQueueWait, 10000000, MICROSECOND)            \
   HT(turbofan_osr_prepare, V8.TurboFanOptimizeForOnStackReplacementPrepare,    \
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_execute, V8.TurboFanOptimizeForOnStackReplacementExecute,    \
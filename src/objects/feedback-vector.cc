@@ -305,6 +305,10 @@ Handle<FeedbackVector> FeedbackVector::New(
     i += entry_size;
   }
 
+  if (V8_UNLIKELY(isolate->cached_feedback() != nullptr)) {
+    isolate->ApplyCachedFeedback(*vector);
+  }
+
   Handle<FeedbackVector> result = Handle<FeedbackVector>::cast(vector);
   if (!isolate->is_best_effort_code_coverage() ||
       isolate->is_collecting_type_profile()) {
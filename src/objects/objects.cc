@@ -6664,10 +6664,10 @@ uint32_t HashTable<Derived, Shape>::FindInsertionEntry(uint32_t hash) {
   return entry;
 }
 
-void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
-                                                   int expected) {
+void StringTable::EnsureCapacityForBulkInsertion(Isolate* isolate,
+                                                 int expected) {
   Handle<StringTable> table = isolate->factory()->string_table();
-  // We need a key instance for the virtual hash function.
+  if (table->HasSufficientCapacityToAdd(expected)) return;
   table = StringTable::EnsureCapacity(isolate, table, expected);
   isolate->heap()->SetRootStringTable(*table);
 }
@@ -6709,23 +6709,58 @@ Handle<String> StringTable::LookupString(Isolate* isolate,
 
 // static
 template <typename StringTableKey>
-Handle<String> StringTable::LookupKey(Isolate* isolate, StringTableKey* key) {
+MaybeHandle<String> StringTable::LookupKeyIfExists(Isolate* isolate,
+                                                   StringTableKey* key) {
   Handle<StringTable> table = isolate->factory()->string_table();
   int entry = table->FindEntry(isolate, key);
+  if (entry == kNotFound) return MaybeHandle<String>();
+  return handle(String::cast(table->KeyAt(entry)), isolate);
+}
+
+// static
+template <typename StringTableKey>
+Handle<String> StringTable::LookupKey(Isolate* isolate, StringTableKey* key) {
+  return LookupKey(isolate, key, kAllowShrink);
+}
 
+// static
+template <typename StringTableKey>
+Handle<String> StringTable::LookupKeyNoShrink(Isolate* isolate,
+                                              StringTableKey* key) {
+  return LookupKey(isolate, key, kNoShrink);
+}
+
+// static
+template <typename StringTableKey>
+Handle<String> StringTable::LookupKey(Isolate* isolate, StringTableKey* key,
+                                      ShrinkMode shrink_mode) {
   // String already in table.
-  if (entry != kNotFound) {
-    return handle(String::cast(table->KeyAt(entry)), isolate);
-  }
+  Handle<String> result;
+  if (LookupKeyIfExists(isolate, key).ToHandle(&result)) return result;
 
-  table = StringTable::CautiousShrink(isolate, table);
-  // Adding new string. Grow table if needed.
+  Handle<StringTable> table = isolate->factory()->string_table();
+  if (shrink_mode == kAllowShrink) {
+    table = StringTable::CautiousShrink(isolate, table);
+  }
+  // Adding new string. Grow table if needed. Without shrinking, this only
+  // happens once capacity reserved by EnsureCapacityForBulkInsertion() is
+  // used up.
   table = StringTable::EnsureCapacity(isolate, table, 1);
   isolate->heap()->SetRootStringTable(*table);
 
   return AddKeyNoResize(isolate, key);
 }
 
+template MaybeHandle<String> StringTable::LookupKeyIfExists(
+    Isolate* isolate, OneByteStringKey* key);
+template MaybeHandle<String> StringTable::LookupKeyIfExists(
+    Isolate* isolate, TwoByteStringKey* key);
+
+template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE) Handle<String>
+    StringTable::LookupKeyNoShrink(Isolate* isolate, OneByteStringKey* key);
+template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE) Handle<String>
+    StringTable::LookupKeyNoShrink(Isolate* isolate, TwoByteStringKey* key);
+
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
                                                OneByteStringKey* key);
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
@@ -67,6 +67,18 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
                                                        Handle<String> key);
   template <typename StringTableKey>
   static Handle<String> LookupKey(Isolate* isolate, StringTableKey* key);
+  // Like LookupKey, but never shrinks the table, so that capacity reserved
+  // through EnsureCapacityForBulkInsertion() is kept while a batch of strings
+  // is added.
+  template <typename StringTableKey>
+  EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE)
+  static Handle<String> LookupKeyNoShrink(Isolate* isolate,
+                                          StringTableKey* key);
+  // Returns the string matching |key| if it is already internalized, without
+  // adding it or resizing the table.
+  template <typename StringTableKey>
+  static MaybeHandle<String> LookupKeyIfExists(Isolate* isolate,
+                                               StringTableKey* key);
   static Handle<String> AddKeyNoResize(Isolate* isolate, StringTableKey* key);
 
   // Shink the StringTable if it's very empty (kMaxEmptyFactor) to avoid the
@@ -80,7 +92,11 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
   V8_EXPORT_PRIVATE static Address LookupStringIfExists_NoAllocate(
       Isolate* isolate, Address raw_string);
 
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Grows the table so that |expected| strings can be added without another
+  // resize. Used before internalizing many strings at once, e.g. after
+  // deserialization or (background) parsing.
+  V8_EXPORT_PRIVATE static void EnsureCapacityForBulkInsertion(Isolate* isolate,
+                                                             int expected);
 
   DECL_CAST(StringTable)
 
@@ -92,6 +108,11 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
   template <typename char_type>
   friend class JsonParser;
 
+  enum ShrinkMode { kAllowShrink, kNoShrink };
+  template <typename StringTableKey>
+  static Handle<String> LookupKey(Isolate* isolate, StringTableKey* key,
+                                  ShrinkMode shrink_mode);
+
   OBJECT_CONSTRUCTORS(StringTable, HashTable<StringTable, StringTableShape>);
 };
 
@@ -58,6 +58,18 @@ void LiteralBuffer::ConvertToTwoByte() {
   is_one_byte_ = false;
 }
 
+void LiteralBuffer::AddAsciiChars(Vector<const uint16_t> code_units) {
+  int size = code_units.length() * (is_one_byte() ? kOneByteSize : kUC16Size);
+  while (position_ + size > backing_store_.length()) ExpandBuffer();
+  if (is_one_byte()) {
+    CopyChars(&backing_store_[position_], code_units.begin(),
+              code_units.length());
+  } else {
+    MemCopy(&backing_store_[position_], code_units.begin(), size);
+  }
+  position_ += size;
+}
+
 void LiteralBuffer::AddTwoByteChar(uc32 code_unit) {
   DCHECK(!is_one_byte());
   if (position_ >= backing_store_.length()) ExpandBuffer();
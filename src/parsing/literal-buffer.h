@@ -34,6 +34,9 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of ASCII code units at once.
+  void AddAsciiChars(Vector<const uint16_t> code_units);
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(Vector<const char> keyword) const {
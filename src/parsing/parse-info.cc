@@ -237,15 +237,31 @@ void ParseInfo::set_script(Handle<Script> script) {
   }
 }
 
+ParseInfo::ParallelTasks::ParallelTasks(
+    CompilerDispatcher* compiler_dispatcher)
+    : dispatcher_(compiler_dispatcher),
+      group_(std::make_shared<CompilerDispatcherJobGroup>(dispatcher_)) {
+  DCHECK(dispatcher_);
+}
+
+ParseInfo::ParallelTasks::~ParallelTasks() { group_->Abandon(); }
+
 void ParseInfo::ParallelTasks::Enqueue(ParseInfo* outer_parse_info,
                                        const AstRawString* function_name,
                                        FunctionLiteral* literal) {
   base::Optional<CompilerDispatcher::JobId> job_id =
-      dispatcher_->Enqueue(outer_parse_info, function_name, literal);
+      dispatcher_->Enqueue(outer_parse_info, function_name, literal, group_);
   if (job_id) {
     enqueued_jobs_.emplace_front(std::make_pair(literal, *job_id));
   }
 }
 
+void ParseInfo::ParallelTasks::AbortAll() {
+  for (auto& it : enqueued_jobs_) {
+    dispatcher_->AbortJob(it.second);
+  }
+  enqueued_jobs_.clear();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -28,6 +28,7 @@ class AstRawString;
 class AstStringConstants;
 class AstValueFactory;
 class CompilerDispatcher;
+class CompilerDispatcherJobGroup;
 class DeclarationScope;
 class FunctionLiteral;
 class RuntimeCallStats;
@@ -221,14 +222,22 @@ class V8_EXPORT_PRIVATE ParseInfo {
 
   class ParallelTasks {
    public:
-    explicit ParallelTasks(CompilerDispatcher* compiler_dispatcher)
-        : dispatcher_(compiler_dispatcher) {
-      DCHECK(dispatcher_);
-    }
+    explicit ParallelTasks(CompilerDispatcher* compiler_dispatcher);
+    // Abandons the jobs that were never handed over to their shared function
+    // infos, e.g. because a streamed script was dropped before finalization.
+    // The dispatcher aborts them later on the main thread, so this is safe on
+    // any thread and after the isolate was torn down.
+    ~ParallelTasks();
 
     void Enqueue(ParseInfo* outer_parse_info, const AstRawString* function_name,
                  FunctionLiteral* literal);
 
+    // Aborts all enqueued jobs. Must be called on the main thread.
+    void AbortAll();
+    // Forgets the enqueued jobs once they were registered with their shared
+    // function infos, after which the compiler dispatcher owns them.
+    void Clear() { enqueued_jobs_.clear(); }
+
     using EnqueuedJobsIterator =
         std::forward_list<std::pair<FunctionLiteral*, uintptr_t>>::iterator;
 
@@ -239,6 +248,7 @@ class V8_EXPORT_PRIVATE ParseInfo {
 
    private:
     CompilerDispatcher* dispatcher_;
+    std::shared_ptr<CompilerDispatcherJobGroup> group_;
     std::forward_list<std::pair<FunctionLiteral*, uintptr_t>> enqueued_jobs_;
   };
 
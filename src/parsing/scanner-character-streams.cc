@@ -149,43 +149,46 @@ class TestingStream {
 template <typename Char>
 class ChunkedStream {
  public:
-  explicit ChunkedStream(ScriptCompiler::ExternalSourceStream* source)
-      : source_(source) {}
-
-  ChunkedStream(const ChunkedStream&) V8_NOEXCEPT {
-    // TODO(rmcilroy): Implement cloning for chunked streams.
-    UNREACHABLE();
-  }
+  explicit ChunkedStream(
+      std::shared_ptr<ScriptCompiler::ExternalSourceStream> source)
+      : source_(std::move(source)),
+        source_keeps_data_ownership_(source_->KeepsDataOwnership()) {}
+
+  // A clone shares the chunks fetched so far but cannot fetch more data from
+  // the source stream, which only the original may consume. Reading past the
+  // fetched chunks yields the end of the stream. This suffices for parallel
+  // compile tasks, which only read functions the original has already scanned.
+  ChunkedStream(const ChunkedStream& other) V8_NOEXCEPT
+      : source_(nullptr),
+        source_keeps_data_ownership_(false),
+        chunks_(other.chunks_) {}
 
   // The no_gc argument is only here because of the templated way this class
   // is used along with other implementations that require V8 heap access.
   Range<Char> GetDataAt(size_t pos, RuntimeCallStats* stats,
                         DisallowHeapAllocation* no_gc = nullptr) {
-    Chunk chunk = FindChunk(pos, stats);
+    const Chunk& chunk = FindChunk(pos, stats);
     size_t buffer_end = chunk.length;
     size_t buffer_pos = Min(buffer_end, pos - chunk.position);
-    return {&chunk.data[buffer_pos], &chunk.data[buffer_end]};
-  }
-
-  ~ChunkedStream() {
-    for (Chunk& chunk : chunks_) delete[] chunk.data;
+    return {&chunk.data.get()[buffer_pos], &chunk.data.get()[buffer_end]};
   }
 
-  static const bool kCanBeCloned = false;
+  static const bool kCanBeCloned = true;
   static const bool kCanAccessHeap = false;
 
  private:
   struct Chunk {
-    Chunk(const Char* const data, size_t position, size_t length)
-        : data(data), position(position), length(length) {}
-    const Char* const data;
+    Chunk(std::shared_ptr<const Char> data, size_t position, size_t length)
+        : data(std::move(data)), position(position), length(length) {}
+    // The data is shared with the chunks of clones of this stream.
+    const std::shared_ptr<const Char> data;
     // The logical position of data.
     const size_t position;
     const size_t length;
     size_t end_position() const { return position + length; }
   };
 
-  Chunk FindChunk(size_t position, RuntimeCallStats* stats) {
+  const Chunk& FindChunk(size_t position, RuntimeCallStats* stats) {
     while (V8_UNLIKELY(chunks_.empty())) FetchChunk(size_t{0}, stats);
 
     // Walk forwards while the position is in front of the current chunk.
@@ -207,14 +210,23 @@ class ChunkedStream {
                             size_t length) {
     // Incoming data has to be aligned to Char size.
     DCHECK_EQ(0, length % sizeof(Char));
-    chunks_.emplace_back(reinterpret_cast<const Char*>(data), position,
+    const Char* chars = reinterpret_cast<const Char*>(data);
+    // Data that the source stream keeps ownership of is read in place and
+    // keeps the source stream alive for as long as clones can read it.
+    std::shared_ptr<const Char> chunk_data =
+        source_keeps_data_ownership_
+            ? std::shared_ptr<const Char>(source_, chars)
+            : std::shared_ptr<const Char>(
+                  chars, [](const Char* ptr) { delete[] ptr; });
+    chunks_.emplace_back(std::move(chunk_data), position,
                          length / sizeof(Char));
   }
 
   void FetchChunk(size_t position, RuntimeCallStats* stats) {
     const uint8_t* data = nullptr;
-    size_t length;
-    {
+    size_t length = 0;
+    // Clones have no source stream; an empty chunk marks the end of their data.
+    if (source_ != nullptr) {
       RuntimeCallTimerScope scope(stats,
                                   RuntimeCallCounterId::kGetMoreDataCallback);
       length = source_->GetMoreData(&data);
@@ -222,7 +234,8 @@ class ChunkedStream {
     ProcessChunk(data, position, length);
   }
 
-  ScriptCompiler::ExternalSourceStream* source_;
+  std::shared_ptr<ScriptCompiler::ExternalSourceStream> source_;
+  const bool source_keeps_data_ownership_;
 
  protected:
   std::vector<struct Chunk> chunks_;
@@ -302,6 +315,7 @@ class UnbufferedCharacterStream : public Utf16CharacterStream {
   }
 
   std::unique_ptr<Utf16CharacterStream> Clone() const override {
+    CHECK(can_be_cloned());
     return std::unique_ptr<Utf16CharacterStream>(
         new UnbufferedCharacterStream<ByteStream>(*this));
   }
@@ -427,8 +441,10 @@ class Utf8ExternalStreamingStream : public BufferedUtf16CharacterStream {
   Utf8ExternalStreamingStream(
       ScriptCompiler::ExternalSourceStream* source_stream)
       : current_({0, {0, 0, 0, unibrow::Utf8::State::kAccept}}),
-        source_stream_(source_stream) {}
+        source_stream_(source_stream),
+        source_keeps_data_ownership_(source_stream->KeepsDataOwnership()) {}
   ~Utf8ExternalStreamingStream() final {
+    if (source_keeps_data_ownership_) return;
     for (const Chunk& chunk : chunks_) delete[] chunk.data;
   }
 
@@ -485,6 +501,7 @@ class Utf8ExternalStreamingStream : public BufferedUtf16CharacterStream {
   std::vector<Chunk> chunks_;
   Position current_;
   ScriptCompiler::ExternalSourceStream* source_stream_;
+  const bool source_keeps_data_ownership_;
 };
 
 bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
@@ -799,7 +816,7 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
 }
 
 Utf16CharacterStream* ScannerStream::For(
-    ScriptCompiler::ExternalSourceStream* source_stream,
+    std::shared_ptr<ScriptCompiler::ExternalSourceStream> source_stream,
     v8::ScriptCompiler::StreamedSource::Encoding encoding) {
   switch (encoding) {
     case v8::ScriptCompiler::StreamedSource::TWO_BYTE:
@@ -809,10 +826,20 @@ Utf16CharacterStream* ScannerStream::For(
       return new BufferedCharacterStream<ChunkedStream>(static_cast<size_t>(0),
                                                         source_stream);
     case v8::ScriptCompiler::StreamedSource::UTF8:
-      return new Utf8ExternalStreamingStream(source_stream);
+      return new Utf8ExternalStreamingStream(source_stream.get());
   }
   UNREACHABLE();
 }
 
+Utf16CharacterStream* ScannerStream::For(
+    ScriptCompiler::ExternalSourceStream* source_stream,
+    v8::ScriptCompiler::StreamedSource::Encoding encoding) {
+  // Alias an empty shared pointer so that |source_stream| isn't owned.
+  return For(std::shared_ptr<ScriptCompiler::ExternalSourceStream>(
+                 std::shared_ptr<ScriptCompiler::ExternalSourceStream>(),
+                 source_stream),
+             encoding);
+}
+
 }  // namespace internal
 }  // namespace v8
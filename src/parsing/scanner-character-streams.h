@@ -22,6 +22,11 @@ class V8_EXPORT_PRIVATE ScannerStream {
   static Utf16CharacterStream* For(Isolate* isolate, Handle<String> data);
   static Utf16CharacterStream* For(Isolate* isolate, Handle<String> data,
                                    int start_pos, int end_pos);
+  static Utf16CharacterStream* For(
+      std::shared_ptr<ScriptCompiler::ExternalSourceStream> source_stream,
+      ScriptCompiler::StreamedSource::Encoding encoding);
+  // The caller has to keep |source_stream| alive for as long as the returned
+  // stream and its clones.
   static Utf16CharacterStream* For(
       ScriptCompiler::ExternalSourceStream* source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding);
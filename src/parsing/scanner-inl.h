@@ -5,13 +5,96 @@
 #ifndef V8_PARSING_SCANNER_INL_H_
 #define V8_PARSING_SCANNER_INL_H_
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/parsing/keywords-gen.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 
+#if V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+// ----------------------------------------------------------------------------
+// Block scanning of ASCII runs
+
+// Returns the first code unit in [start, end) that isn't ASCII or is one of
+// |Stops|, or |end| if there is none. Eight code units are checked at a time
+// with SIMD instructions that all CPUs of the host architecture support.
+template <uint16_t... Stops>
+V8_INLINE const uint16_t* FindNonAsciiOrOneOf(const uint16_t* start,
+                                              const uint16_t* end) {
+  static constexpr uint16_t kStops[] = {Stops...};
+  STATIC_ASSERT(unibrow::Utf8::kMaxOneByteChar == 0x7F);
+#if V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
+  const __m128i non_ascii_bits = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+  while (end - start >= 8) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(chars, non_ascii_bits),
+                                    _mm_setzero_si128());
+    __m128i hits = _mm_setzero_si128();
+    for (uint16_t stop : kStops) {
+      __m128i stops = _mm_set1_epi16(static_cast<int16_t>(stop));
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi16(chars, stops));
+    }
+    // Two mask bits per code unit.
+    uint32_t mask = (~_mm_movemask_epi8(ascii) | _mm_movemask_epi8(hits)) &
+                    0xFFFF;
+    if (mask != 0) return start + base::bits::CountTrailingZeros(mask) / 2;
+    start += 8;
+  }
+#elif V8_HOST_ARCH_ARM64
+  const uint16x8_t max_ascii = vdupq_n_u16(unibrow::Utf8::kMaxOneByteChar);
+  while (end - start >= 8) {
+    uint16x8_t chars = vld1q_u16(start);
+    uint16x8_t hits = vcgtq_u16(chars, max_ascii);
+    for (uint16_t stop : kStops) {
+      hits = vorrq_u16(hits, vceqq_u16(chars, vdupq_n_u16(stop)));
+    }
+    // The scalar loop below finds the exact position.
+    if (vmaxvq_u16(hits) != 0) break;
+    start += 8;
+  }
+#endif
+  for (; start < end; ++start) {
+    uint16_t c = *start;
+    if (c > unibrow::Utf8::kMaxOneByteChar) return start;
+    for (uint16_t stop : kStops) {
+      if (c == stop) return start;
+    }
+  }
+  return end;
+}
+
+template <uint16_t... Stops, typename SkipFunction, typename CheckFunction>
+V8_INLINE uc32 Utf16CharacterStream::AdvanceUntilSkippingAscii(
+    SkipFunction skip_run, CheckFunction check) {
+  while (true) {
+    const uint16_t* run_end =
+        FindNonAsciiOrOneOf<Stops...>(buffer_cursor_, buffer_end_);
+    if (run_end != buffer_cursor_) {
+      skip_run(Vector<const uint16_t>(
+          buffer_cursor_, static_cast<size_t>(run_end - buffer_cursor_)));
+      buffer_cursor_ = run_end;
+    }
+
+    if (buffer_cursor_ == buffer_end_) {
+      if (!ReadBlockChecked()) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    } else {
+      uc32 c0 = static_cast<uc32>(*buffer_cursor_++);
+      if (check(c0)) return c0;
+    }
+  }
+}
+
 // ----------------------------------------------------------------------------
 // Keyword Matcher
 
@@ -202,7 +202,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  AdvanceUntilSkippingAscii<'\n', '\r'>(
+      [](Vector<const uint16_t>) {},
+      [](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
 
   return Token::WHITESPACE;
 }
@@ -274,13 +276,15 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      AdvanceUntilSkippingAscii<'\n', '\r', '*'>(
+          [](Vector<const uint16_t>) {},
+          [](uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            return MultilineCommentCharacterNeedsSlowPath(char_flags);
+          });
 
       while (c0_ == '*') {
         Advance();
@@ -299,7 +303,8 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](uc32 c0) { return c0 == '*'; });
+    AdvanceUntilSkippingAscii<'*'>([](Vector<const uint16_t>) {},
+                                   [](uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -451,19 +456,23 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    AdvanceUntilSkippingAscii<'\'', '"', '\\', '\n', '\r'>(
+        [this](Vector<const uint16_t> run) {
+          next().literal_chars.AddAsciiChars(run);
+        },
+        [this](uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+              return true;
+            }
+            AddLiteralChar(c0);
+            return false;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          if (MayTerminateString(char_flags)) return true;
+          AddLiteralChar(c0);
+          return false;
+        });
 
     while (c0_ == '\\') {
       Advance();
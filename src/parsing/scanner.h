@@ -90,6 +90,13 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but skips runs of ASCII code units that are none of
+  // |Stops| several code units at a time. |check| must return false for all
+  // such code units; the skipped runs are passed to |skip_run| instead.
+  template <uint16_t... Stops, typename SkipFunction, typename CheckFunction>
+  V8_INLINE uc32 AdvanceUntilSkippingAscii(SkipFunction skip_run,
+                                           CheckFunction check);
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -530,6 +537,12 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <uint16_t... Stops, typename SkipFunction, typename CheckFunction>
+  V8_INLINE void AdvanceUntilSkippingAscii(SkipFunction skip_run,
+                                           CheckFunction check) {
+    c0_ = source_->AdvanceUntilSkippingAscii<Stops...>(skip_run, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -1991,6 +1991,11 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
+  // The mapping from heap objects to entries is only needed while extracting
+  // references. Release it before the snapshot allocates its children index,
+  // so that both are not alive at the same time during peak memory usage.
+  HeapEntriesMap().swap(entries_map_);
+
   snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
@@ -2022,6 +2027,9 @@ void HeapSnapshotGenerator::InitProgressCounter() {
   // breaks the DevTools frontend.
   progress_total_ = v8_heap_explorer_.EstimateObjectsCount() + 1;
   progress_counter_ = 0;
+  // Every object gets an entry, so size the map upfront instead of rehashing
+  // it repeatedly while the heap is walked.
+  entries_map_.reserve(progress_total_);
 }
 
 bool HeapSnapshotGenerator::FillReferences() {
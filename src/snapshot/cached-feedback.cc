@@ -0,0 +1,147 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/cached-feedback.h"
+
+#include <set>
+
+#include "src/execution/isolate.h"
+#include "src/execution/runtime-profiler.h"
+#include "src/handles/global-handles.h"
+#include "src/heap/factory.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/maybe-object-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+bool WasOptimized(FeedbackVector vector) {
+  if (vector.has_optimized_code()) return true;
+  switch (vector.optimization_marker()) {
+    case OptimizationMarker::kCompileOptimized:
+    case OptimizationMarker::kCompileOptimizedConcurrent:
+    case OptimizationMarker::kInOptimizationQueue:
+      return true;
+    case OptimizationMarker::kNone:
+    case OptimizationMarker::kLogFirstExecution:
+      return false;
+  }
+  UNREACHABLE();
+}
+
+// Slots whose feedback is a Smi that does not depend on the heap.
+bool IsCacheableSlotKind(FeedbackSlotKind kind) {
+  return kind == FeedbackSlotKind::kBinaryOp ||
+         kind == FeedbackSlotKind::kCompareOp ||
+         kind == FeedbackSlotKind::kForIn;
+}
+
+}  // namespace
+
+void CachedFeedback::RecordOptimizedFunction(Isolate* isolate,
+                                             Handle<JSFunction> function) {
+  Handle<WeakArrayList> list = optimized_vectors_.is_null()
+                                   ? isolate->factory()->empty_weak_array_list()
+                                   : optimized_vectors_;
+  if (list->length() > 0 && list->IsFull()) {
+    // Drop the vectors of collected functions before growing the list.
+    int live = 0;
+    for (int i = 0; i < list->length(); i++) {
+      MaybeObject entry = list->Get(i);
+      if (!entry->IsCleared()) list->Set(live++, entry);
+    }
+    for (int i = live; i < list->length(); i++) {
+      list->Set(i, HeapObjectReference::ClearedValue(isolate));
+    }
+    list->set_length(live);
+  }
+  Handle<FeedbackVector> vector(function->feedback_vector(), isolate);
+  Handle<WeakArrayList> new_list = WeakArrayList::AddToEnd(
+      isolate, list, MaybeObjectHandle::Weak(vector));
+  if (*new_list != *list) {
+    if (!optimized_vectors_.is_null()) {
+      GlobalHandles::Destroy(optimized_vectors_.location());
+    }
+    optimized_vectors_ = isolate->global_handles()->Create(*new_list);
+  }
+}
+
+void CachedFeedback::Collect(Script script, std::vector<uint32_t>* data) {
+  if (optimized_vectors_.is_null()) return;
+  DisallowHeapAllocation no_gc;
+  std::set<int> collected;
+  WeakArrayList::Iterator iterator(*optimized_vectors_);
+  for (HeapObject obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    FeedbackVector vector = FeedbackVector::cast(obj);
+    SharedFunctionInfo shared = vector.shared_function_info();
+    if (shared.script() != script || !WasOptimized(vector)) continue;
+    int function_literal_id = shared.FunctionLiteralId();
+    if (!collected.insert(function_literal_id).second) continue;
+
+    data->push_back(static_cast<uint32_t>(function_literal_id));
+    size_t count_index = data->size();
+    data->push_back(0);
+    FeedbackMetadataIterator it(vector.metadata());
+    while (it.HasNext()) {
+      FeedbackSlot slot = it.Next();
+      if (!IsCacheableSlotKind(it.kind())) continue;
+      Smi value;
+      if (!vector.Get(slot)->ToSmi(&value) || value == Smi::zero()) continue;
+      data->push_back(static_cast<uint32_t>(slot.ToInt()));
+      data->push_back(static_cast<uint32_t>(value.value()));
+      (*data)[count_index]++;
+    }
+  }
+}
+
+void CachedFeedback::Register(Script script, Vector<const uint32_t> data) {
+  size_t i = 0;
+  while (i + 2 <= data.size()) {
+    int function_literal_id = static_cast<int>(data[i]);
+    size_t count = data[i + 1];
+    i += 2;
+    if (count > (data.size() - i) / 2) break;
+    std::vector<SlotFeedback>& slots =
+        functions_[std::make_pair(script.id(), function_literal_id)];
+    for (size_t j = 0; j < count; j++, i += 2) {
+      slots.push_back(
+          {static_cast<int>(data[i]), static_cast<int>(data[i + 1])});
+    }
+  }
+}
+
+void CachedFeedback::Apply(FeedbackVector vector) {
+  if (functions_.empty()) return;
+  SharedFunctionInfo shared = vector.shared_function_info();
+  if (!shared.script().IsScript()) return;
+  // Looking up the function literal id of a compiled function is linear in
+  // the number of functions in the script, so check the script id first.
+  int script_id = Script::cast(shared.script()).id();
+  auto it = functions_.lower_bound(std::make_pair(script_id, 0));
+  if (it == functions_.end() || it->first.first != script_id) return;
+  it = functions_.find(std::make_pair(script_id, shared.FunctionLiteralId()));
+  if (it == functions_.end()) return;
+
+  FeedbackMetadata metadata = vector.metadata();
+  for (const SlotFeedback& feedback : it->second) {
+    if (feedback.slot < 0 || feedback.slot >= metadata.slot_count()) continue;
+    if (!Smi::IsValid(feedback.value)) continue;
+    FeedbackSlot slot(feedback.slot);
+    if (!IsCacheableSlotKind(metadata.GetKind(slot))) continue;
+    vector.Set(slot, Smi::FromInt(feedback.value), SKIP_WRITE_BARRIER);
+  }
+  vector.set_profiler_ticks(
+      RuntimeProfiler::TicksForOptimization(shared.GetBytecodeArray()));
+  functions_.erase(it);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,66 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_CACHED_FEEDBACK_H_
+#define V8_SNAPSHOT_CACHED_FEEDBACK_H_
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "src/handles/handles.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+class FeedbackVector;
+class Isolate;
+class JSFunction;
+class Script;
+class WeakArrayList;
+
+// Type feedback of functions that were optimized when a code cache was
+// produced (see --cache-feedback). After the code cache has been consumed,
+// the feedback vectors of these functions are pre-seeded with the recorded
+// feedback and enough profiler ticks to be optimized on the next tick,
+// instead of going through the full warmup again.
+//
+// Only feedback that does not refer to heap objects can be carried over to
+// another process, i.e. the hints of binary operations, comparisons and
+// for-in statements. Map and call target feedback is collected again.
+class CachedFeedback {
+ public:
+  // Remembers the feedback vector of |function|, which is being optimized,
+  // so that Collect can find it without iterating the heap.
+  void RecordOptimizedFunction(Isolate* isolate, Handle<JSFunction> function);
+
+  // Appends the feedback of all optimized functions of |script| to |data|.
+  void Collect(Script script, std::vector<uint32_t>* data);
+
+  // Remembers |data|, as produced by Collect, for the functions of |script|.
+  void Register(Script script, Vector<const uint32_t> data);
+
+  // Seeds the freshly allocated |vector| with the feedback recorded for its
+  // function, if there is any. Feedback is only applied once.
+  void Apply(FeedbackVector vector);
+
+ private:
+  struct SlotFeedback {
+    int slot;
+    int value;
+  };
+
+  // Weak list of the feedback vectors of functions that were sent to the
+  // optimizing compiler, held through a global handle.
+  Handle<WeakArrayList> optimized_vectors_;
+
+  // Keyed by script id and function literal id.
+  std::map<std::pair<int, int>, std::vector<SlotFeedback>> functions_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_CACHED_FEEDBACK_H_
@@ -12,6 +12,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/snapshot/cached-feedback.h"
 #include "src/snapshot/object-deserializer.h"
 #include "src/snapshot/snapshot.h"
 #include "src/utils/version.h"
@@ -57,10 +58,16 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // context independent.
   if (script->ContainsAsmModule()) return nullptr;
 
+  std::vector<uint32_t> cached_feedback;
+  if (FLAG_cache_feedback && isolate->cached_feedback() != nullptr) {
+    isolate->cached_feedback()->Collect(*script, &cached_feedback);
+  }
+
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
                                  source, script->origin_options()));
+  cs.cached_feedback_ = std::move(cached_feedback);
   DisallowHeapAllocation no_gc;
   cs.reference_map()->AddAttachedReference(
       reinterpret_cast<void*>(source->ptr()));
@@ -301,6 +308,12 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
   }
 
+  Vector<const uint32_t> cached_feedback = scd.CachedFeedbackData();
+  if (!cached_feedback.empty()) {
+    isolate->EnsureCachedFeedback()->Register(Script::cast(result->script()),
+                                              cached_feedback);
+  }
+
   const bool log_code_creation =
       isolate->logger()->is_listening_to_code_events() ||
       isolate->is_profiling() ||
@@ -359,9 +372,11 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   // Calculate sizes.
   uint32_t reservation_size =
       static_cast<uint32_t>(reservations.size()) * kUInt32Size;
-  uint32_t num_stub_keys = 0;  // TODO(jgruber): Remove.
-  uint32_t stub_keys_size = num_stub_keys * kUInt32Size;
-  uint32_t payload_offset = kHeaderSize + reservation_size + stub_keys_size;
+  const std::vector<uint32_t>& cached_feedback = cs->cached_feedback();
+  uint32_t cached_feedback_size =
+      static_cast<uint32_t>(cached_feedback.size()) * kUInt32Size;
+  uint32_t payload_offset =
+      kHeaderSize + reservation_size + cached_feedback_size;
   uint32_t padded_payload_offset = POINTER_SIZE_ALIGN(payload_offset);
   uint32_t size =
       padded_payload_offset + static_cast<uint32_t>(payload->size());
@@ -380,6 +395,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   SetHeaderValue(kFlagHashOffset, FlagList::Hash());
   SetHeaderValue(kNumReservationsOffset,
                  static_cast<uint32_t>(reservations.size()));
+  SetHeaderValue(kNumCachedFeedbackOffset,
+                 static_cast<uint32_t>(cached_feedback.size()));
   SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
 
   // Zero out any padding in the header.
@@ -390,6 +407,11 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
             reinterpret_cast<const byte*>(reservations.data()),
             reservation_size);
 
+  // Copy cached feedback.
+  CopyBytes(data_ + kHeaderSize + reservation_size,
+            reinterpret_cast<const byte*>(cached_feedback.data()),
+            cached_feedback_size);
+
   // Copy serialized data.
   CopyBytes(data_ + padded_payload_offset, payload->data(),
             static_cast<size_t>(payload->size()));
@@ -413,10 +435,18 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
   if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
-  uint32_t max_payload_length =
-      this->size_ -
-      POINTER_SIZE_ALIGN(kHeaderSize +
-                         GetHeaderValue(kNumReservationsOffset) * kInt32Size);
+  // The header is not covered by the checksum, so bound the section sizes
+  // before they are used to compute offsets.
+  uint32_t max_entries = (this->size_ - kHeaderSize) / kUInt32Size;
+  uint32_t num_reservations = GetHeaderValue(kNumReservationsOffset);
+  if (num_reservations > max_entries) return LENGTH_MISMATCH;
+  uint32_t num_cached_feedback = GetHeaderValue(kNumCachedFeedbackOffset);
+  if (num_cached_feedback > max_entries - num_reservations) {
+    return LENGTH_MISMATCH;
+  }
+  uint32_t payload_offset = PayloadOffset();
+  if (payload_offset > this->size_) return LENGTH_MISMATCH;
+  uint32_t max_payload_length = this->size_ - payload_offset;
   if (payload_length > max_payload_length) return LENGTH_MISMATCH;
   if (!Checksum(ChecksummedContent()).Check(c1, c2)) return CHECKSUM_MISMATCH;
   return CHECK_SUCCESS;
@@ -452,11 +482,25 @@ std::vector<SerializedData::Reservation> SerializedCodeData::Reservations()
   return reservations;
 }
 
+Vector<const uint32_t> SerializedCodeData::CachedFeedbackData() const {
+  uint32_t offset =
+      kHeaderSize + GetHeaderValue(kNumReservationsOffset) * kInt32Size;
+  return Vector<const uint32_t>(
+      reinterpret_cast<const uint32_t*>(data_ + offset),
+      GetHeaderValue(kNumCachedFeedbackOffset));
+}
+
+uint32_t SerializedCodeData::PayloadOffset() const {
+  uint32_t reservations_size =
+      GetHeaderValue(kNumReservationsOffset) * kInt32Size;
+  uint32_t cached_feedback_size =
+      GetHeaderValue(kNumCachedFeedbackOffset) * kUInt32Size;
+  return POINTER_SIZE_ALIGN(kHeaderSize + reservations_size +
+                            cached_feedback_size);
+}
+
 Vector<const byte> SerializedCodeData::Payload() const {
-  int reservations_size = GetHeaderValue(kNumReservationsOffset) * kInt32Size;
-  int payload_offset = kHeaderSize + reservations_size;
-  int padded_payload_offset = POINTER_SIZE_ALIGN(payload_offset);
-  const byte* payload = data_ + padded_payload_offset;
+  const byte* payload = data_ + PayloadOffset();
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
   int length = GetHeaderValue(kPayloadLengthOffset);
   DCHECK_EQ(data_ + size_, payload + length);
@@ -55,6 +55,9 @@ class CodeSerializer : public Serializer {
       ScriptOriginOptions origin_options);
 
   uint32_t source_hash() const { return source_hash_; }
+  const std::vector<uint32_t>& cached_feedback() const {
+    return cached_feedback_;
+  }
 
  protected:
   CodeSerializer(Isolate* isolate, uint32_t source_hash);
@@ -70,6 +73,8 @@ class CodeSerializer : public Serializer {
 
   DISALLOW_HEAP_ALLOCATION(no_gc_)
   uint32_t source_hash_;
+  // Encoded type feedback of optimized functions, see CachedFeedback.
+  std::vector<uint32_t> cached_feedback_;
   DISALLOW_COPY_AND_ASSIGN(CodeSerializer);
 };
 
@@ -96,8 +101,9 @@ class SerializedCodeData : public SerializedData {
   // [5] payload length
   // [6] payload checksum part A
   // [7] payload checksum part B
+  // [8] number of cached feedback entries
   // ...  reservations
-  // ...  code stub keys
+  // ...  cached feedback
   // ...  serialized payload
   static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
   static const uint32_t kSourceHashOffset = kVersionHashOffset + kUInt32Size;
@@ -109,8 +115,10 @@ class SerializedCodeData : public SerializedData {
       kPayloadLengthOffset + kUInt32Size;
   static const uint32_t kChecksumPartBOffset =
       kChecksumPartAOffset + kUInt32Size;
-  static const uint32_t kUnalignedHeaderSize =
+  static const uint32_t kNumCachedFeedbackOffset =
       kChecksumPartBOffset + kUInt32Size;
+  static const uint32_t kUnalignedHeaderSize =
+      kNumCachedFeedbackOffset + kUInt32Size;
   static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
 
   // Used when consuming.
@@ -127,6 +135,7 @@ class SerializedCodeData : public SerializedData {
   ScriptData* GetScriptData();
 
   std::vector<Reservation> Reservations() const;
+  Vector<const uint32_t> CachedFeedbackData() const;
   Vector<const byte> Payload() const;
 
   static uint32_t SourceHash(Handle<String> source,
@@ -137,6 +146,8 @@ class SerializedCodeData : public SerializedData {
   SerializedCodeData(const byte* data, int size)
       : SerializedData(const_cast<byte*>(data), size) {}
 
+  uint32_t PayloadOffset() const;
+
   Vector<const byte> ChecksummedContent() const {
     return Vector<const byte>(data_ + kHeaderSize, size_ - kHeaderSize);
   }
@@ -68,7 +68,7 @@ void ObjectDeserializer::FlushICache() {
 
 void ObjectDeserializer::CommitPostProcessedObjects() {
   CHECK_LE(new_internalized_strings().size(), kMaxInt);
-  StringTable::EnsureCapacityForDeserialization(
+  StringTable::EnsureCapacityForBulkInsertion(
       isolate(), static_cast<int>(new_internalized_strings().size()));
   for (Handle<String> string : new_internalized_strings()) {
     DisallowHeapAllocation no_gc;
@@ -41,7 +41,7 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   CheckVersion(blob);
-  CHECK(VerifyChecksum(blob));
+  if (FLAG_verify_snapshot_checksum) CHECK(VerifyStartupChecksum(blob));
   Vector<const byte> startup_data = ExtractStartupData(blob);
   SnapshotData startup_snapshot_data(startup_data);
   Vector<const byte> read_only_data = ExtractReadOnlyData(blob);
@@ -70,6 +70,11 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   if (FLAG_profile_deserialization) timer.Start();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
+  if (FLAG_verify_snapshot_checksum &&
+      !isolate->context_snapshot_verified(context_index)) {
+    CHECK(VerifyContextChecksum(blob, static_cast<uint32_t>(context_index)));
+    isolate->set_context_snapshot_verified(context_index);
+  }
   bool can_rehash = ExtractRehashability(blob);
   Vector<const byte> context_data =
       ExtractContextData(blob, static_cast<uint32_t>(context_index));
@@ -192,6 +197,14 @@ v8::StartupData Snapshot::CreateSnapshotBlob(
   DCHECK_EQ(total_length, payload_offset);
   v8::StartupData result = {data, static_cast<int>(total_length)};
 
+  for (uint32_t i = 0; i < num_contexts; i++) {
+    Checksum context_checksum(ExtractContextData(&result, i));
+    SetHeaderValue(data, ContextChecksumPartAOffset(num_contexts, i),
+                   context_checksum.a());
+    SetHeaderValue(data, ContextChecksumPartBOffset(num_contexts, i),
+                   context_checksum.b());
+  }
+
   Checksum checksum(ChecksummedContent(&result));
   SetHeaderValue(data, kChecksumPartAOffset, checksum.a());
   SetHeaderValue(data, kChecksumPartBOffset, checksum.b());
@@ -206,6 +219,15 @@ uint32_t Snapshot::ExtractNumContexts(const v8::StartupData* data) {
 }
 
 bool Snapshot::VerifyChecksum(const v8::StartupData* data) {
+  if (!VerifyStartupChecksum(data)) return false;
+  uint32_t num_contexts = ExtractNumContexts(data);
+  for (uint32_t i = 0; i < num_contexts; i++) {
+    if (!VerifyContextChecksum(data, i)) return false;
+  }
+  return true;
+}
+
+bool Snapshot::VerifyStartupChecksum(const v8::StartupData* data) {
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
   uint32_t expected_a = GetHeaderValue(data, kChecksumPartAOffset);
@@ -218,6 +240,24 @@ bool Snapshot::VerifyChecksum(const v8::StartupData* data) {
   return checksum.Check(expected_a, expected_b);
 }
 
+bool Snapshot::VerifyContextChecksum(const v8::StartupData* data,
+                                     uint32_t index) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+  uint32_t num_contexts = ExtractNumContexts(data);
+  uint32_t expected_a =
+      GetHeaderValue(data, ContextChecksumPartAOffset(num_contexts, index));
+  uint32_t expected_b =
+      GetHeaderValue(data, ContextChecksumPartBOffset(num_contexts, index));
+  Checksum checksum(ExtractContextData(data, index));
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Verifying context #%u snapshot checksum took %0.3f ms]\n", index,
+           ms);
+  }
+  return checksum.Check(expected_a, expected_b);
+}
+
 uint32_t Snapshot::ExtractContextOffset(const v8::StartupData* data,
                                         uint32_t index) {
   // Extract the offset of the context at a given index from the StartupData,
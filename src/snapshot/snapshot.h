@@ -72,8 +72,19 @@ class Snapshot : public AllStatic {
   // To be implemented by the snapshot source.
   static const v8::StartupData* DefaultSnapshotBlob();
 
+  // Verifies the checksums of all sections of the snapshot blob.
   V8_EXPORT_PRIVATE static bool VerifyChecksum(const v8::StartupData* data);
 
+  // The header, startup and read-only sections share one checksum, which is
+  // verified when the isolate is deserialized. Context snapshots have their
+  // own checksums, which are only verified the first time the respective
+  // context is deserialized in an isolate, so that unused contexts are never
+  // touched.
+  V8_EXPORT_PRIVATE static bool VerifyStartupChecksum(
+      const v8::StartupData* data);
+  V8_EXPORT_PRIVATE static bool VerifyContextChecksum(
+      const v8::StartupData* data, uint32_t index);
+
   // ---------------- Serialization ----------------
 
   static v8::StartupData CreateSnapshotBlob(
@@ -118,6 +129,9 @@ class Snapshot : public AllStatic {
   // [7] offset to context 1
   // ...
   // ... offset to context N - 1
+  // ... checksum part A and B of context 0
+  // ...
+  // ... checksum part A and B of context N - 1
   // ... startup snapshot data
   // ... read-only snapshot data
   // ... context 0 snapshot data
@@ -139,22 +153,36 @@ class Snapshot : public AllStatic {
   static const uint32_t kFirstContextOffsetOffset =
       kReadOnlyOffsetOffset + kUInt32Size;
 
+  // Covers the header (starting at the version string), the startup and the
+  // read-only snapshot data. Context snapshot data is checksummed separately.
   static Vector<const byte> ChecksummedContent(const v8::StartupData* data) {
     const uint32_t kChecksumStart = kVersionStringOffset;
+    uint32_t num_contexts = ExtractNumContexts(data);
+    uint32_t checksum_end =
+        num_contexts > 0 ? ExtractContextOffset(data, 0) : data->raw_size;
     return Vector<const byte>(
         reinterpret_cast<const byte*>(data->data + kChecksumStart),
-        data->raw_size - kChecksumStart);
+        checksum_end - kChecksumStart);
   }
 
   static uint32_t StartupSnapshotOffset(int num_contexts) {
     return POINTER_SIZE_ALIGN(kFirstContextOffsetOffset +
-                              num_contexts * kInt32Size);
+                              num_contexts * (kInt32Size + 2 * kUInt32Size));
   }
 
   static uint32_t ContextSnapshotOffsetOffset(int index) {
     return kFirstContextOffsetOffset + index * kInt32Size;
   }
 
+  static uint32_t ContextChecksumPartAOffset(int num_contexts, int index) {
+    return kFirstContextOffsetOffset + num_contexts * kInt32Size +
+           index * 2 * kUInt32Size;
+  }
+
+  static uint32_t ContextChecksumPartBOffset(int num_contexts, int index) {
+    return ContextChecksumPartAOffset(num_contexts, index) + kUInt32Size;
+  }
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(Snapshot);
 };
 
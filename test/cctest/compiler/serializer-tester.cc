@@ -13,6 +13,7 @@
 #include "src/compiler/serializer-for-background-compilation.h"
 #include "src/compiler/zone-stats.h"
 #include "src/zone/zone.h"
+#include "test/common/wasm/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -57,9 +58,11 @@ TEST(SerializeEmptyFunction) {
 
 // This helper function allows for testing weather an inlinee candidate
 // was properly serialized. It expects that the top-level function (that is
-// run through the SerializerTester) will return its inlinee candidate.
+// run through the SerializerTester) will return its inlinee candidate. If
+// {expect_serialized} is false, it checks that the candidate was skipped.
 void CheckForSerializedInlinee(const char* source, int argc = 0,
-                               Handle<Object> argv[] = {}) {
+                               Handle<Object> argv[] = {},
+                               bool expect_serialized = true) {
   SerializerTester tester(source);
   JSFunctionRef f = tester.function();
   CHECK(f.IsSerializedForCompilation());
@@ -75,7 +78,7 @@ void CheckForSerializedInlinee(const char* source, int argc = 0,
                               handle(g_func->shared(), tester.isolate()));
   FeedbackVectorRef g_fv(tester.broker(),
                          handle(g_func->feedback_vector(), tester.isolate()));
-  CHECK(g_sfi.IsSerializedForCompilation(g_fv));
+  CHECK_EQ(expect_serialized, g_sfi.IsSerializedForCompilation(g_fv));
 }
 
 TEST(SerializeInlinedClosure) {
@@ -288,6 +291,35 @@ TEST(MergeJumpTargetEnvironment) {
       "f(); return f;");  // Two calls to f to make g() megamorhpic.
 }
 
+TEST(SerializeInlineeBeyondBudget) {
+  // Candidates that the inliner could never inline are not serialized.
+  FlagScope<int> budget_scope(&FLAG_max_inlined_bytecode_size_absolute, 0);
+  CheckForSerializedInlinee(
+      "function g() { return 1; };"
+      "%EnsureFeedbackVectorForFunction(g);"
+      "function f() {"
+      "  g(); return g;"
+      "};"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "f(); return f;",
+      0, nullptr, false);
+}
+
+TEST(SerializeInlineeBelowMinFrequency) {
+  // Candidates at call sites that the inlining heuristic would not consider
+  // are not serialized.
+  CheckForSerializedInlinee(
+      "function g() { return 1; };"
+      "%EnsureFeedbackVectorForFunction(g);"
+      "function f(x) {"
+      "  if (x) g(); return g;"
+      "};"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "for (let i = 0; i < 19; ++i) f(false);"
+      "f(true); return f;",
+      0, nullptr, false);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
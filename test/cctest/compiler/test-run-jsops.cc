@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/objects/objects-inl.h"
+#include "src/objects/string-inl.h"
 #include "test/cctest/compiler/function-tester.h"
 
 namespace v8 {
@@ -529,6 +530,32 @@ TEST(ClassLiteral) {
   T.CheckCall(T.Val("ab"), T.Val("a"), T.Val("b"));
 }
 
+
+TEST(StringAppendInLoop) {
+  FLAG_turbo_string_accumulation = true;
+  FunctionTester T(
+      "(function() {"
+      "  var s = '';"
+      "  for (var i = 0; i < 140; ++i) s += 'ab';"
+      "  return s;"
+      "})");
+
+  std::string expected;
+  for (int i = 0; i < 140; ++i) expected += "ab";
+  Handle<Object> result = T.Call().ToHandleChecked();
+  CHECK(result->IsString());
+  Handle<String> string = Handle<String>::cast(result);
+  // Without buffering, every piece adds a node to the left spine of the
+  // rope. The buffer collects 7 pieces before it is attached.
+  int depth = 0;
+  for (String s = *string; s.IsConsString(); s = ConsString::cast(s).first()) {
+    ++depth;
+  }
+  CHECK_LE(depth, 140 / 7);
+  string = String::Flatten(T.isolate, string);
+  CHECK(string->IsOneByteEqualTo(CStrVector(expected.c_str())));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <utility>
 
+#include "include/v8-metrics.h"
 #include "src/api/api-inl.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
@@ -6572,6 +6573,80 @@ UNINITIALIZED_TEST(RestoreHeapLimit) {
   reinterpret_cast<v8::Isolate*>(isolate)->Dispose();
 }
 
+UNINITIALIZED_TEST(SetMaxOldGenerationSize) {
+  ManualGCScope manual_gc_scope;
+  const size_t kOldGenerationLimit = 300 * MB;
+  FLAG_max_old_space_size = kOldGenerationLimit / MB;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* v8_isolate = v8::Isolate::New(create_params);
+  Heap* heap = reinterpret_cast<Isolate*>(v8_isolate)->heap();
+  CHECK_EQ(kOldGenerationLimit, heap->MaxOldGenerationSize());
+  // Lowering the limit takes effect immediately.
+  v8_isolate->SetMaxOldGenerationSize(kOldGenerationLimit / 2);
+  CHECK_EQ(kOldGenerationLimit / 2, heap->MaxOldGenerationSize());
+  // Raising the limit takes effect immediately.
+  v8_isolate->SetMaxOldGenerationSize(2 * kOldGenerationLimit);
+  CHECK_EQ(2 * kOldGenerationLimit, heap->MaxOldGenerationSize());
+  // The limit never drops below the live size.
+  v8_isolate->SetMaxOldGenerationSize(0);
+  CHECK_LE(Heap::MinOldGenerationSize(), heap->MaxOldGenerationSize());
+  CHECK_LE(heap->SizeOfObjects(), heap->MaxOldGenerationSize());
+  v8_isolate->Dispose();
+}
+
+namespace {
+
+class CountingMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(
+      const v8::metrics::GarbageCollectionCycle& event) override {
+    events_++;
+    last_type_ = event.type;
+    last_phase_count_ = event.phase_count;
+    CHECK_LE(event.start_time_in_ms, event.end_time_in_ms);
+    for (size_t i = 0; i < event.phase_count; i++) {
+      CHECK_NOT_NULL(event.phases[i].name);
+      CHECK_LT(0, event.phases[i].duration_in_ms);
+    }
+  }
+
+  int events_ = 0;
+  v8::metrics::GarbageCollectionCycle::Type last_type_;
+  size_t last_phase_count_ = 0;
+};
+
+}  // namespace
+
+TEST(MetricsRecorderReceivesGarbageCollectionCycles) {
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  auto recorder = std::make_shared<CountingMetricsRecorder>();
+  isolate->SetMetricsRecorder(recorder);
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK_LT(0, recorder->events_);
+  CHECK(recorder->last_type_ ==
+            v8::metrics::GarbageCollectionCycle::Type::kScavenge ||
+        recorder->last_type_ ==
+            v8::metrics::GarbageCollectionCycle::Type::kMinorMarkCompact);
+
+  int events = recorder->events_;
+  CcTest::CollectAllGarbage();
+  CHECK_LT(events, recorder->events_);
+  CHECK(recorder->last_type_ ==
+            v8::metrics::GarbageCollectionCycle::Type::kMarkCompact ||
+        recorder->last_type_ ==
+            v8::metrics::GarbageCollectionCycle::Type::kIncrementalMarkCompact);
+  CHECK_LT(0, recorder->last_phase_count_);
+
+  isolate->SetMetricsRecorder(nullptr);
+  events = recorder->events_;
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(events, recorder->events_);
+}
+
 void HeapTester::UncommitFromSpace(Heap* heap) {
   heap->UncommitFromSpace();
   heap->memory_allocator()->unmapper()->EnsureUnmappingCompleted();
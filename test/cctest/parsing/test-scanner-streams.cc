@@ -850,14 +850,14 @@ TEST(CloneCharacterStreams) {
     CHECK(!two_byte_string_stream->can_be_cloned());
   }
 
-  // Chunk sources currently not cloneable.
+  // One- and two-byte chunk sources are cloneable, UTF-8 ones are not.
   {
     const char* chunks[] = {"1234", "\0"};
     ChunkSource chunk_source(chunks);
     std::unique_ptr<i::Utf16CharacterStream> one_byte_streaming_stream(
         i::ScannerStream::For(&chunk_source,
                               v8::ScriptCompiler::StreamedSource::ONE_BYTE));
-    CHECK(!one_byte_streaming_stream->can_be_cloned());
+    CHECK(one_byte_streaming_stream->can_be_cloned());
 
     std::unique_ptr<i::Utf16CharacterStream> utf8_streaming_stream(
         i::ScannerStream::For(&chunk_source,
@@ -867,6 +867,99 @@ TEST(CloneCharacterStreams) {
     std::unique_ptr<i::Utf16CharacterStream> two_byte_streaming_stream(
         i::ScannerStream::For(&chunk_source,
                               v8::ScriptCompiler::StreamedSource::TWO_BYTE));
-    CHECK(!two_byte_streaming_stream->can_be_cloned());
+    CHECK(two_byte_streaming_stream->can_be_cloned());
+  }
+
+  // Clones of chunked streams only see the chunks fetched before cloning.
+  {
+    const char* chunks[] = {"1234", "5678", "\0"};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<i::Utf16CharacterStream> stream(i::ScannerStream::For(
+        &chunk_source, v8::ScriptCompiler::StreamedSource::ONE_BYTE));
+    CHECK_EQ('1', stream->Advance());
+    std::unique_ptr<i::Utf16CharacterStream> clone = stream->Clone();
+
+    // The original keeps fetching from the source.
+    for (const char* c = "2345678"; *c != '\0'; c++) {
+      CHECK_EQ(*c, stream->Advance());
+    }
+    CHECK_LT(stream->Advance(), 0);
+
+    // The clone ends where the original was when it was cloned.
+    clone->Seek(0);
+    for (const char* c = "1234"; *c != '\0'; c++) {
+      CHECK_EQ(*c, clone->Advance());
+    }
+    CHECK_LT(clone->Advance(), 0);
+
+    // Cloning after everything was fetched gives a complete copy.
+    std::unique_ptr<i::Utf16CharacterStream> full_clone = stream->Clone();
+    full_clone->Seek(2);
+    for (const char* c = "345678"; *c != '\0'; c++) {
+      CHECK_EQ(*c, full_clone->Advance());
+    }
+    CHECK_LT(full_clone->Advance(), 0);
+  }
+}
+
+namespace {
+
+// A source that keeps ownership of its chunks and records its destruction.
+class OwningChunkSource : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  OwningChunkSource(const char** chunks, bool* destroyed)
+      : chunks_(chunks), destroyed_(destroyed) {}
+  ~OwningChunkSource() override { *destroyed_ = true; }
+
+  bool KeepsDataOwnership() override { return true; }
+
+  size_t GetMoreData(const uint8_t** src) override {
+    *src = reinterpret_cast<const uint8_t*>(*chunks_);
+    size_t length = strlen(*chunks_);
+    if (length > 0) chunks_++;
+    return length;
+  }
+
+ private:
+  const char** chunks_;
+  bool* destroyed_;
+};
+
+}  // anonymous namespace
+
+TEST(StreamingSourceKeepsDataOwnership) {
+  // The chunks are static strings, so freeing them would crash.
+  const char* chunks[] = {"abc", "def", ""};
+  for (auto encoding : {v8::ScriptCompiler::StreamedSource::ONE_BYTE,
+                        v8::ScriptCompiler::StreamedSource::UTF8}) {
+    bool destroyed = false;
+    auto source = std::make_shared<OwningChunkSource>(chunks, &destroyed);
+    std::unique_ptr<i::Utf16CharacterStream> stream(
+        i::ScannerStream::For(source, encoding));
+    for (const char* c = "abcdef"; *c != '\0'; c++) {
+      CHECK_EQ(*c, stream->Advance());
+    }
+    CHECK_LT(stream->Advance(), 0);
+
+    if (!stream->can_be_cloned()) {
+      stream.reset();
+      source.reset();
+      CHECK(destroyed);
+      continue;
+    }
+
+    // Clones keep reading the chunks after the source and the original stream
+    // are gone.
+    std::unique_ptr<i::Utf16CharacterStream> clone = stream->Clone();
+    stream.reset();
+    source.reset();
+    CHECK(!destroyed);
+    clone->Seek(0);
+    for (const char* c = "abcdef"; *c != '\0'; c++) {
+      CHECK_EQ(*c, clone->Advance());
+    }
+    CHECK_LT(clone->Advance(), 0);
+    clone.reset();
+    CHECK(destroyed);
   }
 }
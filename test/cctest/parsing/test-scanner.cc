@@ -103,5 +103,64 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(AsciiRunsInCommentsAndStrings) {
+  // Comments and string bodies skip runs of ASCII characters in blocks, so
+  // place the interesting characters at all offsets within and across blocks,
+  // including the end of the character stream's buffer.
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  for (size_t length = 0; length < 600; length += length < 40 ? 1 : 97) {
+    std::string run(length, 'a');
+    for (const char* interesting : {"", "\xE9", "*", "/", "\\x41"}) {
+      std::string body = run + interesting + "bcdefghijklmnopqrstuvwxyz";
+
+      {
+        std::string src = "//" + body + "\nx";
+        auto scanner = make_scanner(src.c_str());
+        CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+        CHECK_EQ(static_cast<int>(src.length()) - 1,
+                 scanner->location().beg_pos);
+        CHECK_TOK(Token::EOS, scanner->Next());
+      }
+
+      {
+        std::string src = "/*" + body + "\n" + body + "*/x";
+        auto scanner = make_scanner(src.c_str());
+        CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+        CHECK_EQ(static_cast<int>(src.length()) - 1,
+                 scanner->location().beg_pos);
+        CHECK_TOK(Token::EOS, scanner->Next());
+      }
+
+      for (const char* quote : {"'", "\""}) {
+        std::string src = quote + body + quote;
+        std::string expected = body;
+        if (strcmp(interesting, "\\x41") == 0) {
+          expected = run + "A" + "bcdefghijklmnopqrstuvwxyz";
+        }
+        auto scanner = make_scanner(src.c_str());
+        CHECK_TOK(Token::STRING, scanner->Next());
+        CHECK_EQ(0, strcmp(expected.c_str(),
+                           scanner->CurrentLiteralAsCString(&zone)));
+        CHECK_TOK(Token::EOS, scanner->Next());
+      }
+    }
+
+    // Line terminators end strings and single-line comments.
+    {
+      std::string src = "'" + run + "\n'";
+      auto scanner = make_scanner(src.c_str());
+      CHECK_TOK(Token::ILLEGAL, scanner->Next());
+    }
+
+    {
+      std::string src = "//" + run + "\rx";
+      auto scanner = make_scanner(src.c_str());
+      CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+      CHECK_EQ(static_cast<int>(src.length()) - 1,
+               scanner->location().beg_pos);
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -42,6 +42,7 @@
 #include "src/base/overflowing-math.h"
 #include "src/base/platform/platform.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/debug/debug.h"
 #include "src/execution/arguments.h"
 #include "src/execution/execution.h"
@@ -24249,6 +24250,69 @@ TEST(StreamingBiggerScript) {
   RunStreamingTest(chunks);
 }
 
+TEST(StreamingScriptWithParallelCompileTasks) {
+  // Eagerly compiled top-level functions are compiled by parallel tasks that
+  // read from clones of the streamed source.
+  FlagScope<bool> parallel_compile_tasks(&i::FLAG_parallel_compile_tasks,
+                                         true);
+  FlagScope<bool> compiler_dispatcher(&i::FLAG_compiler_dispatcher, true);
+  const char* chunks[] = {"var a = (function() { var x = 6; ",
+                          "return x; })();\n",
+                          "var b = (function() { return 7; })();\n",
+                          "a + b;", nullptr};
+
+  {
+    LocalContext env;
+    v8::Isolate* isolate = env->GetIsolate();
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    v8::HandleScope scope(isolate);
+
+    v8::ScriptCompiler::StreamedSource source(
+        v8::base::make_unique<TestSourceStream>(chunks),
+        v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+    v8::ScriptCompiler::ScriptStreamingTask* task =
+        v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+    task->Run();
+    delete task;
+
+    v8::ScriptOrigin origin(v8_str("http://foo.com"));
+    char* full_source = TestSourceStream::FullSourceString(chunks);
+    v8::Local<Script> script =
+        v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                    origin)
+            .ToLocalChecked();
+    delete[] full_source;
+
+    // Compiling the script registers the jobs of both functions with their
+    // shared function infos.
+    i::Handle<i::JSFunction> toplevel = v8::Utils::OpenHandle(*script);
+    std::vector<i::Handle<i::SharedFunctionInfo>> functions;
+    i::SharedFunctionInfo::ScriptIterator iterator(
+        i_isolate, i::Script::cast(toplevel->shared().script()));
+    for (i::SharedFunctionInfo shared = iterator.Next(); !shared.is_null();
+         shared = iterator.Next()) {
+      if (shared.is_toplevel()) continue;
+      functions.push_back(i::handle(shared, i_isolate));
+    }
+    CHECK_EQ(2u, functions.size());
+    i::CompilerDispatcher* dispatcher = i_isolate->compiler_dispatcher();
+    for (i::Handle<i::SharedFunctionInfo> shared : functions) {
+      CHECK(dispatcher->IsEnqueued(shared));
+    }
+
+    // The jobs are finalized lazily, when each function is first called.
+    v8::Local<Value> result = script->Run(env.local()).ToLocalChecked();
+    CHECK_EQ(13, result->Int32Value(env.local()).FromJust());
+    for (i::Handle<i::SharedFunctionInfo> shared : functions) {
+      CHECK(!dispatcher->IsEnqueued(shared));
+      CHECK(shared->is_compiled());
+    }
+  }
+
+  // UTF-8 streams can't be cloned, so they are compiled without parallel
+  // tasks.
+  RunStreamingTest(chunks, v8::ScriptCompiler::StreamedSource::UTF8);
+}
 
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
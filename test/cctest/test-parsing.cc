@@ -11374,6 +11374,70 @@ TEST(HashbangSyntaxErrors) {
   SyntaxErrorTest(other_context_data, hashbang_data);
 }
 
+namespace {
+
+// Adds fresh strings to the isolate's string table until it cannot take
+// |count| more of them without growing.
+void FillStringTableUpTo(i::Isolate* isolate, int count) {
+  int i = 0;
+  while (isolate->heap()->string_table().HasSufficientCapacityToAdd(count)) {
+    i::ScopedVector<char> name(32);
+    i::SNPrintF(name, "fillStringTable%d", i++);
+    isolate->factory()->InternalizeUtf8String(name.begin());
+  }
+  CHECK(isolate->heap()->string_table().HasSufficientCapacityToAdd(1));
+}
+
+}  // namespace
+
+TEST(StringTableBulkInsertionKeepsReservation) {
+  CcTest::InitializeVM();
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::HandleScope scope(isolate);
+  const int kCount = 100;
+  FillStringTableUpTo(isolate, kCount);
+
+  i::StringTable::EnsureCapacityForBulkInsertion(isolate, kCount);
+  i::Handle<i::StringTable> reserved = isolate->factory()->string_table();
+  for (int i = 0; i < kCount; i++) {
+    i::ScopedVector<char> name(32);
+    int length = i::SNPrintF(name, "bulkInsertion%d", i);
+    i::OneByteStringKey key(
+        i::Vector<const uint8_t>(
+            reinterpret_cast<const uint8_t*>(name.begin()), length),
+        HashSeed(isolate));
+    i::StringTable::LookupKeyNoShrink(isolate, &key);
+  }
+  // All strings fit into the reserved table, so it was never rehashed.
+  CHECK_EQ(*reserved, *isolate->factory()->string_table());
+}
+
+TEST(AstValueFactoryInternalizeReservesOnlyNewStrings) {
+  CcTest::InitializeVM();
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::HandleScope scope(isolate);
+  const int kCount = 100;
+  for (int i = 0; i < kCount; i++) {
+    i::ScopedVector<char> name(32);
+    i::SNPrintF(name, "alreadyInternalized%d", i);
+    isolate->factory()->InternalizeUtf8String(name.begin());
+  }
+  FillStringTableUpTo(isolate, kCount);
+
+  i::Zone zone(isolate->allocator(), ZONE_NAME);
+  i::AstValueFactory ast_value_factory(
+      &zone, isolate->ast_string_constants(), HashSeed(isolate));
+  for (int i = 0; i < kCount; i++) {
+    i::ScopedVector<char> name(32);
+    i::SNPrintF(name, "alreadyInternalized%d", i);
+    ast_value_factory.GetOneByteString(name.begin());
+  }
+  i::Handle<i::StringTable> table = isolate->factory()->string_table();
+  ast_value_factory.Internalize(isolate);
+  // All strings were already internalized, so no room was reserved for them.
+  CHECK_EQ(*table, *isolate->factory()->string_table());
+}
+
 }  // namespace test_parsing
 }  // namespace internal
 }  // namespace v8
@@ -37,6 +37,7 @@
 #include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/debug/debug.h"
+#include "src/execution/runtime-profiler.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/spaces.h"
@@ -60,6 +61,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/wasm/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -885,6 +887,61 @@ UNINITIALIZED_TEST(SnapshotChecksum) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(SnapshotContextChecksum) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator;
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      creator.SetDefaultContext(v8::Context::New(isolate));
+    }
+    {
+      v8::HandleScope handle_scope(isolate);
+      CHECK_EQ(0u, creator.AddContext(v8::Context::New(isolate)));
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+  CHECK(i::Snapshot::VerifyChecksum(&blob));
+
+  // Flip a bit at the very end of the blob, which belongs to the last context
+  // snapshot. Only that context's checksum is affected.
+  int last = blob.raw_size - 1;
+  const_cast<char*>(blob.data)[last] = blob.data[last] ^ 4;  // Flip a bit.
+  CHECK(!i::Snapshot::VerifyChecksum(&blob));
+  CHECK(i::Snapshot::VerifyStartupChecksum(&blob));
+  CHECK(i::Snapshot::VerifyContextChecksum(&blob, 0));
+  CHECK(!i::Snapshot::VerifyContextChecksum(&blob, 1));
+
+  // The isolate and its default context can still be created from the blob.
+  // Each context checksum is verified once per isolate.
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    CHECK(!i_isolate->context_snapshot_verified(0));
+    for (int run = 0; run < 2; run++) {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      ExpectInt32("1 + 1", 2);
+      CHECK(i_isolate->context_snapshot_verified(0));
+    }
+    CHECK(!i_isolate->context_snapshot_verified(1));
+  }
+
+  isolate->Dispose();
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 struct InternalFieldData {
   uint32_t data;
 };
@@ -2413,6 +2470,78 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerCachedFeedback) {
+  FlagScope<bool> allow_natives_syntax(&FLAG_allow_natives_syntax, true);
+  FlagScope<bool> always_opt(&FLAG_always_opt, false);
+  FlagScope<bool> cache_feedback(&FLAG_cache_feedback, true);
+  const char* source =
+      "function add(a, b) { return a + b; }"
+      "if (this.warmup) {"
+      "  %PrepareFunctionForOptimization(add);"
+      "  add(1.5, 2.5);"
+      "  add(3.5, 4.5);"
+      "  %OptimizeFunctionOnNextCall(add);"
+      "  add(5.5, 6.5);"
+      "}"
+      "add";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    CompileRun("this.warmup = true");
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_object(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source_object)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    cache = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_object(v8_str(source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_object, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> add =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun("add(1, 2)");
+
+    // The vector of add() starts out with the feedback of the first run and
+    // is ready to be optimized.
+    Handle<JSFunction> function =
+        Handle<JSFunction>::cast(v8::Utils::OpenHandle(*add));
+    CHECK(function->has_feedback_vector());
+    FeedbackVector vector = function->feedback_vector();
+    FeedbackSlot slot(0);
+    CHECK_EQ(FeedbackSlotKind::kBinaryOp, vector.metadata().GetKind(slot));
+    CHECK_EQ(BinaryOperationFeedback::kNumber,
+             vector.Get(slot)->ToSmi().value());
+    CHECK_GE(vector.profiler_ticks(),
+             RuntimeProfiler::TicksForOptimization(
+                 function->shared().GetBytecodeArray()));
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -2440,6 +2569,37 @@ TEST(CodeSerializerFlagChange) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerCachedFeedbackSizeOutOfBounds) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  // The header is not checksummed. A cached feedback size that points past
+  // the end of the data must be rejected rather than read.
+  WriteLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(cache->data) +
+          SerializedCodeData::kNumCachedFeedbackOffset,
+      0xFFFFFFF0u);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::ScriptCompiler::CompileUnboundScript(
+        isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+        .ToLocalChecked();
+    CHECK(cache->rejected);
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerBitFlip) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
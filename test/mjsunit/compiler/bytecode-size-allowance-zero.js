@@ -0,0 +1,14 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --bytecode-size-allowance-per-tick=0
+
+// The runtime profiler must not divide by a zero allowance when it computes
+// the tick threshold of a hot function.
+function f(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) sum += i;
+  return sum;
+}
+for (let i = 0; i < 1000; i++) assertEquals(4950, f(100));
@@ -0,0 +1,67 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// An object that is only carried around a loop unchanged must not escape.
+(function() {
+  function f(n) {
+    var o = {x: 1, y: 2};
+    var p = o;
+    var sum = 0;
+    for (var i = 0; i < n; ++i) {
+      if (i > 100) p = o;
+      sum += p.x;
+    }
+    return sum + p.y;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(12, f(10));
+  assertEquals(12, f(10));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(12, f(10));
+  assertEquals(202, f(200));
+})();
+
+// Deoptimizing inside the loop has to materialize the object.
+(function() {
+  function f(n, deopt) {
+    var o = {x: 1};
+    var p = o;
+    for (var i = 0; i < n; ++i) {
+      if (i == deopt) %DeoptimizeNow();
+      if (i > 100) p = o;
+    }
+    return p;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(10, -1).x);
+  assertEquals(1, f(10, -1).x);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1, f(10, -1).x);
+  assertEquals(1, f(10, 5).x);
+})();
+
+// A phi that merges two different objects still makes them escape.
+(function() {
+  function f(n) {
+    var a = {x: 1};
+    var b = {x: 2};
+    var p = a;
+    for (var i = 0; i < n; ++i) {
+      p = (i & 1) ? a : b;
+    }
+    return p.x;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(2, f(1));
+  assertEquals(1, f(2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1, f(0));
+  assertEquals(2, f(3));
+  assertEquals(1, f(4));
+})();
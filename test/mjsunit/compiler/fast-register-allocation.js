@@ -0,0 +1,26 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-fast-register-allocation
+
+function foo(a, b, n) {
+  let x = 0.5, y = 1;
+  for (let i = 0; i < n; i++) {
+    if (i & 1) {
+      x += a * i;
+      y = (y + b) | 0;
+    } else {
+      x -= b / (i + 1);
+      y = (y ^ i) | 0;
+    }
+  }
+  return [x, y];
+}
+
+%PrepareFunctionForOptimization(foo);
+const expected = foo(3, 7, 100);
+foo(3, 7, 100);
+%OptimizeFunctionOnNextCall(foo);
+assertEquals(expected, foo(3, 7, 100));
+assertOptimized(foo);
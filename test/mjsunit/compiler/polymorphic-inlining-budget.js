@@ -0,0 +1,34 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --polymorphic-inlining
+// Flags: --max-inlined-bytecode-size-cumulative=40
+
+// A polymorphic call site whose targets do not all fit into the inlining
+// budget still dispatches to every target correctly.
+(function() {
+  function small(x) { return x + 1; }
+  function big(x) {
+    var y = x;
+    for (var i = 0; i < 3; ++i) {
+      y = y * 2 + i;
+      y = y - i;
+      y = y % 1000;
+    }
+    return y;
+  }
+
+  function f(a, x) {
+    var g = a ? small : big;
+    return g(x);
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(2, f(true, 1));
+  assertEquals(8, f(false, 1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(true, 1));
+  assertEquals(8, f(false, 1));
+  assertOptimized(f);
+})();
@@ -0,0 +1,90 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+(function() {
+  function repeat(piece, n) {
+    var s = "";
+    for (var i = 0; i < n; ++i) {
+      s += piece;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(repeat);
+  assertEquals("ababab", repeat("ab", 3));
+  assertEquals("ababab", repeat("ab", 3));
+  %OptimizeFunctionOnNextCall(repeat);
+  assertEquals("ababab", repeat("ab", 3));
+  assertEquals("ab".repeat(100), repeat("ab", 100));
+  assertEquals("", repeat("ab", 0));
+  assertEquals("", repeat("", 20));
+  assertOptimized(repeat);
+})();
+
+(function() {
+  // The string is rebuilt from its parts when we deoptimize in the loop.
+  function repeat(piece, n, k) {
+    var s = "";
+    for (var i = 0; i < n; ++i) {
+      s += piece;
+      if (i == k) %DeoptimizeNow();
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(repeat);
+  assertEquals("xyzxyz", repeat("xyz", 2, -1));
+  assertEquals("xyzxyz", repeat("xyz", 2, -1));
+  %OptimizeFunctionOnNextCall(repeat);
+  assertEquals("xyz".repeat(50), repeat("xyz", 50, -1));
+  assertEquals("xyz".repeat(50), repeat("xyz", 50, 2));
+  %PrepareFunctionForOptimization(repeat);
+  %OptimizeFunctionOnNextCall(repeat);
+  assertEquals("xyz".repeat(50), repeat("xyz", 50, 30));
+})();
+
+(function() {
+  // An eager deoptimization in the middle of the loop.
+  function join(parts) {
+    var s = "<";
+    for (var i = 0; i < parts.length; ++i) {
+      s += parts[i];
+    }
+    return s + ">";
+  }
+
+  var parts = [];
+  for (var i = 0; i < 40; ++i) parts.push("p" + i);
+  var expected = "<" + parts.join("") + ">";
+  %PrepareFunctionForOptimization(join);
+  assertEquals(expected, join(parts));
+  assertEquals(expected, join(parts));
+  %OptimizeFunctionOnNextCall(join);
+  assertEquals(expected, join(parts));
+  assertOptimized(join);
+  parts[25] = 25;
+  assertEquals("<" + parts.join("") + ">", join(parts));
+  assertUnoptimized(join);
+})();
+
+(function() {
+  // The string is observed in the loop and keeps growing one piece at a time.
+  function prefixes(piece, n) {
+    var s = "";
+    var result = [];
+    for (var i = 0; i < n; ++i) {
+      s += piece;
+      result.push(s);
+    }
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(prefixes);
+  assertEquals(["a", "aa", "aaa"], prefixes("a", 3));
+  assertEquals(["a", "aa", "aaa"], prefixes("a", 3));
+  %OptimizeFunctionOnNextCall(prefixes);
+  assertEquals(["a", "aa", "aaa"], prefixes("a", 3));
+})();
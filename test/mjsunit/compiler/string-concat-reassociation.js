@@ -0,0 +1,39 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function() {
+  function render(rows) {
+    var html = "";
+    for (var i = 0; i < rows.length; ++i) {
+      html = html + "<td>" + rows[i] + "</td>";
+    }
+    return html;
+  }
+
+  var rows = ["a", "bb", "ccc", "dddddddddddddddddddd"];
+  var expected =
+      "<td>a</td><td>bb</td><td>ccc</td><td>dddddddddddddddddddd</td>";
+  %PrepareFunctionForOptimization(render);
+  assertEquals(expected, render(rows));
+  assertEquals(expected, render(rows));
+  %OptimizeFunctionOnNextCall(render);
+  assertEquals(expected, render(rows));
+  assertEquals("", render([]));
+})();
+
+(function() {
+  // The intermediate result is observable and must be preserved.
+  function f(a, b, c) {
+    var ab = a + b;
+    return [ab, ab + c];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(["xy", "xyz"], f("x", "y", "z"));
+  assertEquals(["xy", "xyz"], f("x", "y", "z"));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(["xy", "xyz"], f("x", "y", "z"));
+})();
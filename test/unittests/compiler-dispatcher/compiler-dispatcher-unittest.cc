@@ -69,7 +69,8 @@ class CompilerDispatcherTest : public TestWithNativeContext {
 
   static base::Optional<CompilerDispatcher::JobId> EnqueueUnoptimizedCompileJob(
       CompilerDispatcher* dispatcher, Isolate* isolate,
-      Handle<SharedFunctionInfo> shared) {
+      Handle<SharedFunctionInfo> shared,
+      ParseInfo::ParallelTasks* parallel_tasks = nullptr) {
     std::unique_ptr<ParseInfo> outer_parse_info =
         test::OuterParseInfoForShared(isolate, shared);
     AstValueFactory* ast_value_factory =
@@ -88,7 +89,7 @@ class CompilerDispatcherTest : public TestWithNativeContext {
     function_scope->set_end_position(shared->EndPosition());
     std::vector<void*> pointer_buffer;
     ScopedPtrList<Statement> statements(&pointer_buffer);
-    const FunctionLiteral* function_literal =
+    FunctionLiteral* function_literal =
         ast_node_factory.NewFunctionLiteral(
             function_name, function_scope, statements, -1, -1, -1,
             FunctionLiteral::kNoDuplicateParameters,
@@ -96,6 +97,11 @@ class CompilerDispatcherTest : public TestWithNativeContext {
             FunctionLiteral::kShouldEagerCompile, shared->StartPosition(), true,
             shared->FunctionLiteralId(), nullptr);
 
+    if (parallel_tasks) {
+      parallel_tasks->Enqueue(outer_parse_info.get(), function_name,
+                              function_literal);
+      return base::make_optional(parallel_tasks->begin()->second);
+    }
     return dispatcher->Enqueue(outer_parse_info.get(), function_name,
                                function_literal);
   }
@@ -673,6 +679,61 @@ TEST_F(CompilerDispatcherTest, AbortJobNotStarted) {
   dispatcher.AbortAll();
 }
 
+TEST_F(CompilerDispatcherTest, AbortParallelTasksNotFinalized) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  Handle<SharedFunctionInfo> shared =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  ASSERT_FALSE(shared->is_compiled());
+
+  base::Optional<CompilerDispatcher::JobId> job_id;
+  {
+    // The parallel tasks of a script that is dropped before it is finalized,
+    // e.g. a streamed script whose load was cancelled.
+    ParseInfo::ParallelTasks parallel_tasks(&dispatcher);
+    job_id = EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared,
+                                          &parallel_tasks);
+    ASSERT_TRUE(dispatcher.IsEnqueued(*job_id));
+    ASSERT_FALSE(platform.IdleTaskPending());
+  }
+
+  // Dropping the parallel tasks schedules an idle task that aborts their jobs
+  // on the main thread.
+  ASSERT_TRUE(dispatcher.IsEnqueued(*job_id));
+  ASSERT_TRUE(platform.IdleTaskPending());
+  platform.RunIdleTask(1000.0, 0.0);
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(*job_id));
+  ASSERT_FALSE(shared->is_compiled());
+  ASSERT_FALSE(platform.IdleTaskPending());
+  platform.ClearWorkerTasks();
+  dispatcher.AbortAll();
+}
+
+TEST_F(CompilerDispatcherTest, DropParallelTasksAfterAbortAll) {
+  MockPlatform platform;
+  std::unique_ptr<CompilerDispatcher> dispatcher(
+      new CompilerDispatcher(i_isolate(), &platform, FLAG_stack_size));
+
+  Handle<SharedFunctionInfo> shared =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  std::unique_ptr<ParseInfo::ParallelTasks> parallel_tasks(
+      new ParseInfo::ParallelTasks(dispatcher.get()));
+  base::Optional<CompilerDispatcher::JobId> job_id =
+      EnqueueUnoptimizedCompileJob(dispatcher.get(), i_isolate(), shared,
+                                   parallel_tasks.get());
+  ASSERT_TRUE(dispatcher->IsEnqueued(*job_id));
+
+  // Tearing down the dispatcher, as isolate teardown does, releases the job,
+  // so the parallel tasks can be dropped afterwards.
+  platform.ClearWorkerTasks();
+  dispatcher->AbortAll();
+  dispatcher.reset();
+  parallel_tasks.reset();
+  ASSERT_FALSE(platform.IdleTaskPending());
+}
+
 TEST_F(CompilerDispatcherTest, AbortJobAlreadyStarted) {
   MockPlatform platform;
   CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <memory>
+
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/platform/semaphore.h"
@@ -95,5 +97,47 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, CompileHotterJobsFirst) {
+  // Keep all jobs in the input queue until they are picked up below.
+  bool old_flag = FLAG_block_concurrent_recompilation;
+  FLAG_block_concurrent_recompilation = true;
+
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(
+      Compiler::Compile(fun, Compiler::CLEAR_EXCEPTION, &is_compiled_scope));
+  std::unique_ptr<BlockingCompilationJob> cold(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> warm(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> hot(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> hot_queued_later(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> osr(
+      new BlockingCompilationJob(i_isolate(), fun));
+  osr->compilation_info()->SetOptimizingForOsr(BailoutId(1), nullptr);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  dispatcher.QueueForOptimization(cold.get(), 1);
+  dispatcher.QueueForOptimization(hot.get(), 100);
+  dispatcher.QueueForOptimization(warm.get(), 10);
+  dispatcher.QueueForOptimization(hot_queued_later.get(), 100);
+  dispatcher.QueueForOptimization(osr.get(), 0);
+
+  // OSR jobs come first, then jobs by decreasing invocation count, and jobs
+  // of equal priority in the order they were queued.
+  EXPECT_EQ(osr.get(), dispatcher.NextInput());
+  EXPECT_EQ(hot.get(), dispatcher.NextInput());
+  EXPECT_EQ(hot_queued_later.get(), dispatcher.NextInput());
+  EXPECT_EQ(warm.get(), dispatcher.NextInput());
+  EXPECT_EQ(cold.get(), dispatcher.NextInput());
+  EXPECT_EQ(nullptr, dispatcher.NextInput());
+
+  dispatcher.Stop();
+  FLAG_block_concurrent_recompilation = old_flag;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,6 +6,7 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -22,20 +23,23 @@ class BranchEliminationTest : public GraphTest {
                  MachineOperatorBuilder::kNoFlags) {}
 
   MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
 
-  void Reduce() {
+  void Reduce(PoisoningMitigationLevel poisoning_level =
+                  PoisoningMitigationLevel::kDontPoison) {
     JSOperatorBuilder javascript(zone());
     JSGraph jsgraph(isolate(), graph(), common(), &javascript, nullptr,
                     machine());
     GraphReducer graph_reducer(zone(), graph(), jsgraph.Dead());
     BranchElimination branch_condition_elimination(&graph_reducer, &jsgraph,
-                                                   zone());
+                                                   zone(), poisoning_level);
     graph_reducer.AddReducer(&branch_condition_elimination);
     graph_reducer.ReduceGraph();
   }
 
  private:
   MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_{zone()};
 };
 
 
@@ -208,6 +212,129 @@ TEST_F(BranchEliminationTest, BranchInsideLoopSame) {
   EXPECT_THAT(ret1, IsReturn(IsInt32Constant(2), effect, loop));
 }
 
+TEST_F(BranchEliminationTest, CheckBoundsDominatedByLessThan) {
+  // { if (index < length) return a[index]; }
+  // should not check the bounds of index again.
+  Node* index = Parameter(Type::Range(0.0, 100.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, 1000.0, zone()), 1);
+  Node* condition =
+      graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                       length, graph()->start(), if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 100.0, zone()));
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret1 =
+      graph()->NewNode(common()->Return(), zero, check, check, if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* ret2 = graph()->NewNode(common()->Return(), zero, zero,
+                                graph()->start(), if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret1, ret2));
+
+  Reduce();
+
+  Matcher<Node*> guard = IsTypeGuard(index, if_true);
+  EXPECT_THAT(ret1, IsReturn(guard, guard, if_true));
+  Node* effect = NodeProperties::GetEffectInput(ret1);
+  EXPECT_EQ(graph()->start(), NodeProperties::GetEffectInput(effect));
+}
+
+TEST_F(BranchEliminationTest, CheckBoundsDominatedByLessThanWithPoisoning) {
+  // { if (index < length) return a[index]; }
+  // must keep the bounds check when loads are poisoned, since the branch
+  // may be mispredicted.
+  Node* index = Parameter(Type::Range(0.0, 100.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, 1000.0, zone()), 1);
+  Node* condition =
+      graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                       length, graph()->start(), if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 100.0, zone()));
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret1 =
+      graph()->NewNode(common()->Return(), zero, check, check, if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* ret2 = graph()->NewNode(common()->Return(), zero, zero,
+                                graph()->start(), if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret1, ret2));
+
+  Reduce(PoisoningMitigationLevel::kPoisonCriticalOnly);
+
+  EXPECT_THAT(ret1, IsReturn(check, check, if_true));
+}
+
+TEST_F(BranchEliminationTest, CheckBoundsNotDominatedByLessThan) {
+  // { if (index < length) return 0; return a[index]; }
+  // still needs to check the bounds of index.
+  Node* index = Parameter(Type::Range(0.0, 100.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, 1000.0, zone()), 1);
+  Node* condition =
+      graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* ret1 = graph()->NewNode(common()->Return(), zero, zero,
+                                graph()->start(), if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                       length, graph()->start(), if_false);
+  NodeProperties::SetType(check, Type::Range(0.0, 100.0, zone()));
+  Node* ret2 =
+      graph()->NewNode(common()->Return(), zero, check, check, if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret1, ret2));
+
+  Reduce();
+
+  EXPECT_THAT(ret2, IsReturn(check, check, if_false));
+}
+
+TEST_F(BranchEliminationTest, CheckBoundsMinusZeroIndex) {
+  // { if (index < length) return a[index]; }
+  // must keep the bounds check if index can be -0, since the check
+  // identifies -0 with 0.
+  Node* index = Parameter(
+      Type::Union(Type::Range(0.0, 100.0, zone()), Type::MinusZero(), zone()),
+      0);
+  Node* length = Parameter(Type::Range(0.0, 1000.0, zone()), 1);
+  Node* condition =
+      graph()->NewNode(simplified()->NumberLessThan(), index, length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                       length, graph()->start(), if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 100.0, zone()));
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret1 =
+      graph()->NewNode(common()->Return(), zero, check, check, if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* ret2 = graph()->NewNode(common()->Return(), zero, zero,
+                                graph()->start(), if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret1, ret2));
+
+  Reduce();
+
+  EXPECT_THAT(ret1, IsReturn(check, check, if_true));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
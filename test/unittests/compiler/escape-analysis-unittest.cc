@@ -0,0 +1,158 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/escape-analysis.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/escape-analysis-reducer.h"
+#include "src/compiler/graph-reducer.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+#include "testing/gmock-support.h"
+
+using testing::_;
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+namespace escape_analysis_unittest {
+
+class EscapeAnalysisTest : public TypedGraphTest {
+ public:
+  EscapeAnalysisTest()
+      : TypedGraphTest(3),
+        javascript_(zone()),
+        machine_(zone()),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~EscapeAnalysisTest() override = default;
+
+ protected:
+  void Analyze() {
+    EscapeAnalysis escape_analysis(jsgraph(), zone());
+    escape_analysis.ReduceGraph();
+    GraphReducer reducer(zone(), graph(), jsgraph()->Dead());
+    EscapeAnalysisReducer escape_reducer(&reducer, jsgraph(),
+                                         escape_analysis.analysis_result(),
+                                         zone());
+    reducer.AddReducer(&escape_reducer);
+    reducer.ReduceGraph();
+    escape_reducer.VerifyReplacement();
+  }
+
+  Node* Allocate(int size, Node* effect) {
+    return graph()->NewNode(simplified()->Allocate(Type::Any()),
+                            jsgraph()->Constant(size), effect, start());
+  }
+
+  Node* StoreField(const FieldAccess& access, Node* object, Node* value,
+                   Node* effect) {
+    return graph()->NewNode(simplified()->StoreField(access), object, value,
+                            effect, start());
+  }
+
+  Node* LoadField(const FieldAccess& access, Node* object, Node* effect,
+                  Node* control) {
+    return graph()->NewNode(simplified()->LoadField(access), object, effect,
+                            control);
+  }
+
+  Node* Return(Node* value, Node* effect, Node* control) {
+    Node* ret = graph()->NewNode(common()->Return(), Int32Constant(0), value,
+                                 effect, control);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    return ret;
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+// -----------------------------------------------------------------------------
+// Phi
+
+TEST_F(EscapeAnalysisTest, PhiOfObjectReloadedInLoop) {
+  Node* value = Parameter(Type::Number(), 0);
+  Node* cond = Parameter(Type::Boolean(), 1);
+
+  // var o = new HeapNumber(value); var h = {o};
+  Node* object = Allocate(HeapNumber::kSize, start());
+  Node* effect = StoreField(AccessBuilder::ForHeapNumberValue(), object, value,
+                            object);
+  Node* holder = Allocate(JSObject::kHeaderSize, effect);
+  effect = StoreField(AccessBuilder::ForJSObjectPropertiesOrHash(), holder,
+                      object, holder);
+
+  // for (var p = o; cond;) p = h.o;
+  Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+  Node* effect_phi =
+      graph()->NewNode(common()->EffectPhi(2), effect, effect, loop);
+  Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* reload = LoadField(AccessBuilder::ForJSObjectPropertiesOrHash(),
+                           holder, effect_phi, if_true);
+  loop->ReplaceInput(1, if_true);
+  effect_phi->ReplaceInput(1, reload);
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                               object, reload, loop);
+
+  // return p.value;
+  Node* load =
+      LoadField(AccessBuilder::ForHeapNumberValue(), phi, effect_phi, if_false);
+  Node* ret = Return(load, load, if_false);
+
+  Analyze();
+
+  // Both allocations are gone, and so are the loads.
+  EXPECT_THAT(ret, IsReturn(value, effect_phi, if_false));
+  EXPECT_THAT(effect_phi, IsEffectPhi(start(), effect_phi, loop));
+}
+
+TEST_F(EscapeAnalysisTest, PhiOfTwoObjects) {
+  Node* value = Parameter(Type::Number(), 0);
+  Node* cond = Parameter(Type::Boolean(), 1);
+
+  Node* first = Allocate(HeapNumber::kSize, start());
+  Node* effect =
+      StoreField(AccessBuilder::ForHeapNumberValue(), first, value, first);
+  Node* second = Allocate(HeapNumber::kSize, effect);
+  effect =
+      StoreField(AccessBuilder::ForHeapNumberValue(), second, value, second);
+
+  // for (var p = first; cond;) p = second;
+  Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+  Node* effect_phi =
+      graph()->NewNode(common()->EffectPhi(2), effect, effect, loop);
+  Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  loop->ReplaceInput(1, if_true);
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                               first, second, loop);
+  Node* load =
+      LoadField(AccessBuilder::ForHeapNumberValue(), phi, effect_phi, if_false);
+  Node* ret = Return(load, load, if_false);
+
+  Analyze();
+
+  // The phi does not know which object it holds.
+  EXPECT_THAT(ret, IsReturn(IsLoadField(_, phi, effect_phi, if_false), _, _));
+}
+
+}  // namespace escape_analysis_unittest
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,168 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/string-accumulation.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/compiler/type-cache.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+#include "testing/gmock-support.h"
+
+using testing::_;
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+namespace string_accumulation_unittest {
+
+class StringAccumulationTest : public TypedGraphTest {
+ public:
+  StringAccumulationTest()
+      : TypedGraphTest(3),
+        javascript_(zone()),
+        machine_(zone()),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~StringAccumulationTest() override = default;
+
+ protected:
+  void Accumulate() {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), zone());
+    StringAccumulation(jsgraph(), loop_tree, zone()).Run();
+  }
+
+  // Builds `for (s = initial; cond;) s += piece;` and returns the
+  // StringConcat in the loop body.
+  Node* NewStringLoop(Node* initial, Node* piece, Node** loop_out,
+                      Node** phi_out, Node** exit_out) {
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* branch =
+        graph()->NewNode(common()->Branch(), Parameter(Type::Boolean(), 2),
+                         loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    loop->ReplaceInput(1, if_true);
+    Node* phi =
+        graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                         initial, initial, loop);
+    NodeProperties::SetType(phi, Type::String());
+    Node* length = graph()->NewNode(
+        simplified()->NumberAdd(),
+        graph()->NewNode(simplified()->StringLength(), phi),
+        graph()->NewNode(simplified()->StringLength(), piece));
+    NodeProperties::SetType(length, TypeCache::Get()->kStringLengthType);
+    Node* next =
+        graph()->NewNode(simplified()->StringConcat(), length, phi, piece);
+    NodeProperties::SetType(next, Type::String());
+    phi->ReplaceInput(1, next);
+    *loop_out = loop;
+    *phi_out = phi;
+    *exit_out = if_false;
+    return next;
+  }
+
+  Node* NewFrameState(Node* local) {
+    Node* locals = graph()->NewNode(
+        common()->StateValues(1, SparseInputMask::Dense()), local);
+    Node* empty =
+        graph()->NewNode(common()->StateValues(0, SparseInputMask::Dense()));
+    return graph()->NewNode(
+        common()->FrameState(BailoutId::None(),
+                             OutputFrameStateCombine::Ignore(), nullptr),
+        empty, locals, empty, NumberConstant(0), UndefinedConstant(),
+        start());
+  }
+
+  Node* NewReturn(Node* value, Node* control) {
+    Node* ret = graph()->NewNode(common()->Return(), Int32Constant(0), value,
+                                 start(), control);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    return ret;
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+TEST_F(StringAccumulationTest, AppendInLoop) {
+  Node* initial = Parameter(Type::String(), 0);
+  Node* piece = Parameter(Type::String(), 1);
+  Node *loop, *phi, *exit;
+  Node* next = NewStringLoop(initial, piece, &loop, &phi, &exit);
+  Node* next_length = next->InputAt(0);
+  Node* frame_state = NewFrameState(next);
+  Node* ret = NewReturn(phi, exit);
+
+  Accumulate();
+
+  EXPECT_TRUE(next->IsDead());
+  EXPECT_TRUE(phi->IsDead());
+
+  // After the loop, s = acc + buf.
+  Node* value = NodeProperties::GetValueInput(ret, 1);
+  ASSERT_EQ(IrOpcode::kStringConcat, value->opcode());
+  Node* acc = NodeProperties::GetValueInput(value, 1);
+  Node* buf = NodeProperties::GetValueInput(value, 2);
+
+  // The back edge goes through the check whether the buffer is still flat.
+  Node* merge = loop->InputAt(1);
+  EXPECT_THAT(merge,
+              IsMerge(IsIfTrue(IsBranch(
+                          IsNumberLessThan(
+                              _, IsNumberConstant(ConsString::kMinLength)),
+                          _)),
+                      IsIfFalse(IsBranch(_, _))));
+  Matcher<Node*> t = IsStringConcat(_, buf, piece);
+  Matcher<Node*> empty = IsHeapConstant(factory()->empty_string());
+  EXPECT_THAT(buf, IsPhi(MachineRepresentation::kTagged, empty,
+                         IsPhi(MachineRepresentation::kTagged, t, empty, merge),
+                         loop));
+  EXPECT_THAT(acc, IsPhi(MachineRepresentation::kTagged, initial,
+                         IsPhi(MachineRepresentation::kTagged, acc,
+                               IsStringConcat(next_length, acc, t), merge),
+                         loop));
+
+  // The deoptimizer materializes s' = acc + t.
+  Node* state = frame_state->InputAt(kFrameStateLocalsInput)->InputAt(0);
+  ASSERT_EQ(IrOpcode::kObjectState, state->opcode());
+  ASSERT_EQ(3, state->InputCount());
+  EXPECT_THAT(state->InputAt(0), IsHeapConstant(factory()->cons_string_map()));
+  EXPECT_EQ(acc, state->InputAt(1));
+  EXPECT_THAT(state->InputAt(2), t);
+}
+
+TEST_F(StringAccumulationTest, ObservableInLoop) {
+  Node* initial = Parameter(Type::String(), 0);
+  Node* piece = Parameter(Type::String(), 1);
+  Node *loop, *phi, *exit;
+  Node* next = NewStringLoop(initial, piece, &loop, &phi, &exit);
+  // The intermediate string is inspected on every iteration.
+  Node* branch = NodeProperties::GetControlInput(loop->InputAt(1));
+  branch->ReplaceInput(
+      0, graph()->NewNode(simplified()->StringEqual(), next, piece));
+  NewReturn(phi, exit);
+
+  Accumulate();
+
+  EXPECT_FALSE(next->IsDead());
+  EXPECT_EQ(next, phi->InputAt(1));
+  EXPECT_THAT(loop->InputAt(1), IsIfTrue(_));
+}
+
+}  // namespace string_accumulation_unittest
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
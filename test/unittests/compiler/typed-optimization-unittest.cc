@@ -11,12 +11,14 @@
 #include "src/compiler/machine-operator.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/operator-properties.h"
+#include "src/compiler/type-cache.h"
 #include "src/execution/isolate-inl.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
 #include "testing/gmock-support.h"
 
+using testing::_;
 using testing::IsNaN;
 
 namespace v8 {
@@ -104,6 +106,69 @@ TEST_F(TypedOptimizationTest, ToBooleanWithAny) {
   ASSERT_FALSE(r.Changed());
 }
 
+// -----------------------------------------------------------------------------
+// StringConcat
+
+TEST_F(TypedOptimizationTest, StringConcatReassociates) {
+  Node* a = Parameter(Type::String(), 0);
+  Node* b = Parameter(Type::String(), 1);
+  Node* c = Parameter(Type::String(), 2);
+  Node* ab_length = Parameter(TypeCache::Get()->kStringLengthType, 3);
+  Node* abc_length = Parameter(TypeCache::Get()->kStringLengthType, 4);
+  Node* ab = graph()->NewNode(simplified()->StringConcat(), ab_length, a, b);
+  Node* abc = graph()->NewNode(simplified()->StringConcat(), abc_length, ab, c);
+  Reduction r = Reduce(abc);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(abc,
+              IsStringConcat(abc_length, a,
+                             IsStringConcat(IsNumberAdd(IsStringLength(b),
+                                                        IsStringLength(c)),
+                                            b, c)));
+}
+
+TEST_F(TypedOptimizationTest, StringConcatWithObservableIntermediate) {
+  Node* a = Parameter(Type::String(), 0);
+  Node* b = Parameter(Type::String(), 1);
+  Node* c = Parameter(Type::String(), 2);
+  Node* ab_length = Parameter(TypeCache::Get()->kStringLengthType, 3);
+  Node* abc_length = Parameter(TypeCache::Get()->kStringLengthType, 4);
+  Node* ab = graph()->NewNode(simplified()->StringConcat(), ab_length, a, b);
+  Node* abc = graph()->NewNode(simplified()->StringConcat(), abc_length, ab, c);
+  graph()->NewNode(simplified()->StringEqual(), ab, c);
+  Reduction r = Reduce(abc);
+  ASSERT_FALSE(r.Changed());
+}
+
+TEST_F(TypedOptimizationTest, StringConcatWithIntermediateInFrameState) {
+  Node* a = Parameter(Type::String(), 0);
+  Node* b = Parameter(Type::String(), 1);
+  Node* c = Parameter(Type::String(), 2);
+  Node* ab_length = Parameter(TypeCache::Get()->kStringLengthType, 3);
+  Node* abc_length = Parameter(TypeCache::Get()->kStringLengthType, 4);
+  Node* ab = graph()->NewNode(simplified()->StringConcat(), ab_length, a, b);
+  Node* abc = graph()->NewNode(simplified()->StringConcat(), abc_length, ab, c);
+  Node* locals = graph()->NewNode(
+      common()->StateValues(1, SparseInputMask::Dense()), ab);
+  Node* empty = graph()->NewNode(
+      common()->StateValues(0, SparseInputMask::Dense()));
+  graph()->NewNode(
+      common()->FrameState(BailoutId::None(), OutputFrameStateCombine::Ignore(),
+                           nullptr),
+      empty, locals, empty, NumberConstant(0), UndefinedConstant(),
+      graph()->start());
+  Reduction r = Reduce(abc);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(abc, IsStringConcat(abc_length, a, IsStringConcat(_, b, c)));
+  // The deoptimizer materializes the intermediate from its parts.
+  Node* state = locals->InputAt(0);
+  ASSERT_EQ(IrOpcode::kObjectState, state->opcode());
+  ASSERT_EQ(3, state->InputCount());
+  EXPECT_THAT(state->InputAt(0),
+              IsHeapConstant(factory()->cons_string_map()));
+  EXPECT_EQ(a, state->InputAt(1));
+  EXPECT_EQ(b, state->InputAt(2));
+}
+
 }  // namespace typed_optimization_unittest
 }  // namespace compiler
 }  // namespace internal
@@ -0,0 +1,85 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/backend/instruction-scheduler.h"
+#include "src/compiler/backend/instruction.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class InstructionSchedulerX64Test : public TestWithIsolateAndZone {
+ public:
+  InstructionSchedulerX64Test() : blocks_(CreateSingleBlock(zone())) {}
+  ~InstructionSchedulerX64Test() override = default;
+
+ protected:
+  InstructionSequence* NewSequence(Isolate* isolate) {
+    return new (zone()) InstructionSequence(isolate, zone(), blocks_);
+  }
+
+  static bool UseHostLatencies(InstructionScheduler* scheduler) {
+    return scheduler->use_host_latencies();
+  }
+
+  static int Latency(InstructionScheduler* scheduler, Zone* zone,
+                     ArchOpcode opcode) {
+    return scheduler->GetInstructionLatency(Instruction::New(zone, opcode));
+  }
+
+ private:
+  static InstructionBlocks* CreateSingleBlock(Zone* zone) {
+    InstructionBlock* block = new (zone)
+        InstructionBlock(zone, RpoNumber::FromInt(0), RpoNumber::Invalid(),
+                         RpoNumber::Invalid(), false, false);
+    InstructionBlocks* blocks = zone->NewArray<InstructionBlocks>(1);
+    new (blocks) InstructionBlocks(1, block, zone);
+    return blocks;
+  }
+
+  InstructionBlocks* blocks_;
+};
+
+// The serializer cannot be turned off again, so this gets its own isolate.
+class InstructionSchedulerX64SnapshotTest : public InstructionSchedulerX64Test {
+};
+
+TEST_F(InstructionSchedulerX64Test, HostLatencies) {
+  if (FLAG_predictable) return;
+  InstructionScheduler scheduler(zone(), NewSequence(isolate()));
+  EXPECT_TRUE(UseHostLatencies(&scheduler));
+  // The 64-bit division is never faster than the 32-bit one.
+  EXPECT_LE(Latency(&scheduler, zone(), kX64Idiv32),
+            Latency(&scheduler, zone(), kX64Idiv));
+  EXPECT_LE(Latency(&scheduler, zone(), kX64Udiv32),
+            Latency(&scheduler, zone(), kX64Udiv));
+  EXPECT_EQ(1, Latency(&scheduler, zone(), kX64Add));
+}
+
+TEST_F(InstructionSchedulerX64Test, GenericLatenciesWhenPredictable) {
+  bool old_predictable = FLAG_predictable;
+  FLAG_predictable = true;
+  InstructionScheduler scheduler(zone(), NewSequence(isolate()));
+  EXPECT_FALSE(UseHostLatencies(&scheduler));
+  EXPECT_EQ(49, Latency(&scheduler, zone(), kX64Idiv));
+  EXPECT_EQ(35, Latency(&scheduler, zone(), kX64Idiv32));
+  EXPECT_EQ(38, Latency(&scheduler, zone(), kX64Udiv));
+  EXPECT_EQ(26, Latency(&scheduler, zone(), kX64Udiv32));
+  EXPECT_EQ(5, Latency(&scheduler, zone(), kSSEFloat64Mul));
+  EXPECT_EQ(3, Latency(&scheduler, zone(), kSSEFloat64Add));
+  FLAG_predictable = old_predictable;
+}
+
+TEST_F(InstructionSchedulerX64SnapshotTest, GenericLatencies) {
+  isolate()->enable_serializer();
+  InstructionScheduler scheduler(zone(), NewSequence(isolate()));
+  EXPECT_FALSE(UseHostLatencies(&scheduler));
+  EXPECT_EQ(49, Latency(&scheduler, zone(), kX64Idiv));
+  EXPECT_EQ(26, Latency(&scheduler, zone(), kX64Udiv32));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
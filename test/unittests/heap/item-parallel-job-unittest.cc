@@ -5,6 +5,7 @@
 #include "src/heap/item-parallel-job.h"
 
 #include "src/execution/isolate.h"
+#include "src/init/v8.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -180,6 +181,81 @@ class TaskForDifferentItems : public ItemParallelJob::Task {
   bool* processed_b_;
 };
 
+// Forwards to the current platform, but counts the jobs posted through it.
+// Without |support_jobs| it acts like a platform that doesn't implement
+// PostJob().
+class JobCountingPlatform : public v8::Platform {
+ public:
+  explicit JobCountingPlatform(bool support_jobs)
+      : old_platform_(V8::GetCurrentPlatform()),
+        support_jobs_(support_jobs) {
+    V8::SetPlatformForTesting(this);
+  }
+  ~JobCountingPlatform() override {
+    V8::SetPlatformForTesting(old_platform_);
+  }
+
+  int posted_jobs() const { return posted_jobs_; }
+
+  v8::PageAllocator* GetPageAllocator() override {
+    return old_platform_->GetPageAllocator();
+  }
+
+  int NumberOfWorkerThreads() override {
+    return old_platform_->NumberOfWorkerThreads();
+  }
+
+  std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(
+      v8::Isolate* isolate) override {
+    return old_platform_->GetForegroundTaskRunner(isolate);
+  }
+
+  void CallOnWorkerThread(std::unique_ptr<v8::Task> task) override {
+    old_platform_->CallOnWorkerThread(std::move(task));
+  }
+
+  void CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> task,
+                                 double delay_in_seconds) override {
+    old_platform_->CallDelayedOnWorkerThread(std::move(task), delay_in_seconds);
+  }
+
+  std::unique_ptr<v8::JobHandle> PostJob(
+      v8::TaskPriority priority,
+      std::unique_ptr<v8::JobTask> job_task) override {
+    if (!support_jobs_) return nullptr;
+    posted_jobs_++;
+    return old_platform_->PostJob(priority, std::move(job_task));
+  }
+
+  void CallOnForegroundThread(v8::Isolate* isolate, v8::Task* task) override {
+    UNREACHABLE();
+  }
+
+  void CallDelayedOnForegroundThread(v8::Isolate* isolate, v8::Task* task,
+                                     double delay_in_seconds) override {
+    UNREACHABLE();
+  }
+
+  double MonotonicallyIncreasingTime() override {
+    return old_platform_->MonotonicallyIncreasingTime();
+  }
+
+  double CurrentClockTimeMillis() override {
+    return old_platform_->CurrentClockTimeMillis();
+  }
+
+  v8::TracingController* GetTracingController() override {
+    return old_platform_->GetTracingController();
+  }
+
+ private:
+  v8::Platform* old_platform_;
+  bool support_jobs_;
+  int posted_jobs_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(JobCountingPlatform);
+};
+
 class ItemA : public BaseItem {
  public:
   ~ItemA() override = default;
@@ -288,6 +364,58 @@ TEST_F(ItemParallelJobTest, DistributeItemsMultipleTasks) {
   }
 }
 
+TEST_F(ItemParallelJobTest, RunsBackgroundTasksAsJob) {
+  const int kItemsAndTasks = 16;
+  bool was_processed[kItemsAndTasks] = {};
+  OneShotBarrier barrier(kItemsAndTasks);
+  JobCountingPlatform platform(true);
+  {
+    ItemParallelJob job(i_isolate()->cancelable_task_manager(),
+                        parallel_job_semaphore());
+    for (int i = 0; i < kItemsAndTasks; i++) {
+      job.AddItem(new SimpleItem(&was_processed[i]));
+      job.AddTask(new TaskProcessingOneItem(i_isolate(), &barrier, false));
+    }
+    job.Run();
+  }
+  EXPECT_EQ(1, platform.posted_jobs());
+  for (int i = 0; i < kItemsAndTasks; i++) {
+    EXPECT_TRUE(was_processed[i]);
+  }
+}
+
+TEST_F(ItemParallelJobTest, RunsBackgroundTasksWithoutJobSupport) {
+  const int kItemsAndTasks = 16;
+  bool was_processed[kItemsAndTasks] = {};
+  OneShotBarrier barrier(kItemsAndTasks);
+  JobCountingPlatform platform(false);
+  {
+    ItemParallelJob job(i_isolate()->cancelable_task_manager(),
+                        parallel_job_semaphore());
+    for (int i = 0; i < kItemsAndTasks; i++) {
+      job.AddItem(new SimpleItem(&was_processed[i]));
+      job.AddTask(new TaskProcessingOneItem(i_isolate(), &barrier, false));
+    }
+    job.Run();
+  }
+  EXPECT_EQ(0, platform.posted_jobs());
+  for (int i = 0; i < kItemsAndTasks; i++) {
+    EXPECT_TRUE(was_processed[i]);
+  }
+}
+
+TEST_F(ItemParallelJobTest, SingleTaskDoesNotPostJob) {
+  bool did_run = false;
+  JobCountingPlatform platform(true);
+  ItemParallelJob job(i_isolate()->cancelable_task_manager(),
+                      parallel_job_semaphore());
+  job.AddTask(new SimpleTask(i_isolate(), &did_run));
+  job.AddItem(new ItemParallelJob::Item);
+  job.Run();
+  EXPECT_TRUE(did_run);
+  EXPECT_EQ(0, platform.posted_jobs());
+}
+
 TEST_F(ItemParallelJobTest, DifferentItems) {
   bool item_a = false;
   bool item_b = false;
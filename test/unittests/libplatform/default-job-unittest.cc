@@ -0,0 +1,169 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/default-job.h"
+
+#include <atomic>
+
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/base/template-utils.h"
+#include "src/libplatform/default-platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+namespace default_job_unittest {
+
+// Verify that Cancel() on a job stops running the worker task and causes
+// current workers to yield.
+TEST(DefaultJobTest, CancelJob) {
+  static constexpr size_t kTooManyTasks = 1000;
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform(IdleTaskSupport::kDisabled, nullptr);
+  platform.SetThreadPoolSize(kMaxTask);
+  platform.EnsureBackgroundTaskRunnerInitialized();
+
+  // This Job notifies |threads_running| once started and loops until
+  // ShouldYield() returns true, and then returns.
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      {
+        base::MutexGuard guard(&mutex);
+        worker_count++;
+      }
+      threads_running.NotifyOne();
+      while (!delegate->ShouldYield()) {
+      }
+    }
+
+    size_t GetMaxConcurrency() const override {
+      return max_concurrency.load(std::memory_order_relaxed);
+    }
+
+    base::Mutex mutex;
+    base::ConditionVariable threads_running;
+    size_t worker_count = 0;
+    std::atomic_size_t max_concurrency{kTooManyTasks};
+  };
+
+  auto job = base::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask);
+  state->NotifyConcurrencyIncrease();
+
+  {
+    base::MutexGuard guard(&job_raw->mutex);
+    while (job_raw->worker_count < kMaxTask) {
+      job_raw->threads_running.Wait(&job_raw->mutex);
+    }
+    EXPECT_EQ(kMaxTask, job_raw->worker_count);
+  }
+  state->CancelAndWait();
+  // Workers should return and this test should not hang.
+}
+
+// Verify that Join() on a job contributes to max concurrency and waits for all
+// workers to return.
+TEST(DefaultJobTest, JoinJobContributes) {
+  static constexpr size_t kMaxTask = 4;
+  DefaultPlatform platform(IdleTaskSupport::kDisabled, nullptr);
+  platform.SetThreadPoolSize(kMaxTask);
+  platform.EnsureBackgroundTaskRunnerInitialized();
+
+  // This Job notifies |threads_running| once started and blocks on a barrier
+  // until kMaxTask + 1 threads reach that point, and then returns.
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      base::MutexGuard guard(&mutex);
+      worker_count++;
+      if (worker_count == kMaxTask + 1) {
+        threads_running.NotifyAll();
+        max_concurrency.store(0, std::memory_order_relaxed);
+      } else {
+        while (worker_count < kMaxTask + 1) threads_running.Wait(&mutex);
+      }
+    }
+
+    size_t GetMaxConcurrency() const override {
+      return max_concurrency.load(std::memory_order_relaxed);
+    }
+
+    base::Mutex mutex;
+    base::ConditionVariable threads_running;
+    size_t worker_count = 0;
+    std::atomic_size_t max_concurrency{kMaxTask + 1};
+  };
+
+  auto job = base::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask);
+  state->NotifyConcurrencyIncrease();
+
+  // The main thread contributing is necessary for |worker_count| to reach
+  // kMaxTask + 1 thus, Join() should not hang.
+  state->Join();
+  EXPECT_EQ(0U, job_raw->max_concurrency);
+}
+
+// Verify that the handle returned by Platform::PostJob() processes all work
+// items exactly once, with workers pulling items off a shared counter.
+TEST(DefaultJobTest, PostJobProcessesAllItems) {
+  static constexpr size_t kNumItems = 10000;
+  DefaultPlatform platform(IdleTaskSupport::kDisabled, nullptr);
+  platform.SetThreadPoolSize(4);
+  platform.EnsureBackgroundTaskRunnerInitialized();
+
+  // The job may be destroyed as soon as Join() returns, so the results are
+  // kept outside of it.
+  std::unique_ptr<std::atomic_int[]> processed(
+      new std::atomic_int[kNumItems]());
+
+  class JobTest : public JobTask {
+   public:
+    explicit JobTest(std::atomic_int* processed) : processed_(processed) {}
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      while (!delegate->ShouldYield()) {
+        size_t item = next_item_.fetch_add(1, std::memory_order_relaxed);
+        if (item >= kNumItems) return;
+        processed_[item].fetch_add(1, std::memory_order_relaxed);
+        remaining_.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+
+    size_t GetMaxConcurrency() const override {
+      return remaining_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    std::atomic_int* processed_;
+    std::atomic_size_t next_item_{0};
+    std::atomic_size_t remaining_{kNumItems};
+  };
+
+  std::unique_ptr<JobHandle> handle = platform.PostJob(
+      TaskPriority::kUserBlocking, base::make_unique<JobTest>(processed.get()));
+  ASSERT_TRUE(handle);
+  EXPECT_TRUE(handle->IsRunning());
+  handle->Join();
+  EXPECT_FALSE(handle->IsRunning());
+  for (size_t i = 0; i < kNumItems; i++) {
+    EXPECT_EQ(1, processed[i].load());
+  }
+}
+
+}  // namespace default_job_unittest
+}  // namespace platform
+}  // namespace v8